@@ -0,0 +1,213 @@
+#ifndef FRAME_CLOCK_H
+#define FRAME_CLOCK_H
+
+#include <GLFW/glfw3.h>
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <chrono>
+
+// Swap interval modes for setSwapMode()
+#define SWAP_IMMEDIATE  0   // no vsync, the frame limiter (if any) paces the loop
+#define SWAP_VSYNC      1
+#define SWAP_ADAPTIVE   2   // vsync, but late frames swap immediately instead of waiting a whole refresh
+
+// Wall clock for render loops, built on glfwGetTime() so animation runs at the
+// same speed whatever the refresh rate.
+//
+// Call tick() once per frame. It returns how many fixed steps of fixedStep
+// seconds the simulation should run to catch up with real time (capped at
+// maxSteps so a stall does not snowball), and alpha() is how far real time
+// has got into the next step, for interpolating between the last two states.
+//
+//     FrameClock clock(1.0 / 60.0);
+//     clock.setSwapMode(SWAP_VSYNC);
+//     while (running) {
+//         int steps = clock.tick();
+//         for (int i = 0; i < steps; i++) update(clock.fixedStep);
+//         render(clock.alpha());
+//         swap();
+//         clock.limit();
+//     }
+class FrameClock
+{
+public:
+    double fixedStep;
+    int    maxSteps;
+
+    // frame pacing statistics over the last reporting interval, in milliseconds
+    struct Pacing {
+        int    frames    = 0;
+        double meanMs    = 0.0;
+        double minMs     = 0.0;
+        double maxMs     = 0.0;
+        double jitterMs  = 0.0;   // standard deviation of the frame time
+        int    lateFrames = 0;    // frames longer than 1.5x the target interval
+    };
+
+    // the target rate defaults to the primary monitor's refresh rate
+    FrameClock(double step = 1.0 / 60.0, int maxStepsPerFrame = 8, double statsInterval = 1.0)
+        : fixedStep(step), maxSteps(maxStepsPerFrame), interval(statsInterval)
+    {
+        start = last = glfwGetTime();
+        GLFWmonitor *monitor = glfwGetPrimaryMonitor();
+        const GLFWvidmode *mode = monitor ? glfwGetVideoMode(monitor) : NULL;
+        setTargetRate(mode && mode->refreshRate > 0 ? mode->refreshRate : 60.0);
+        resetStats();
+    }
+
+    // choose vsync, adaptive sync or immediate swaps for the current context;
+    // adaptive falls back to plain vsync where the tear extension is missing
+    int setSwapMode(int mode)
+    {
+        if (mode == SWAP_ADAPTIVE &&
+            !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+            !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+            mode = SWAP_VSYNC;
+        }
+        glfwSwapInterval(mode == SWAP_ADAPTIVE ? -1 : mode == SWAP_VSYNC ? 1 : 0);
+        swapMode = mode;
+        return mode;
+    }
+
+    // parse a swap mode from the command line, returns false if it is unknown
+    static bool parseSwapMode(const std::string &name, int &mode)
+    {
+        if (name == "on") {
+            mode = SWAP_VSYNC;
+        } else if (name == "off") {
+            mode = SWAP_IMMEDIATE;
+        } else if (name == "adaptive") {
+            mode = SWAP_ADAPTIVE;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // expected frame rate, used to pace immediate swaps and to count late
+    // frames; 0 leaves immediate swaps unlimited
+    void setTargetRate(double hz)
+    {
+        targetInterval = hz > 0.0 ? 1.0 / hz : 0.0;
+    }
+
+    // start a new frame; returns the number of fixed steps to run
+    int tick()
+    {
+        double now = glfwGetTime();
+        delta = now - last;
+        last  = now;
+        record(delta);
+
+        accumulator += delta;
+        int steps = (int)(accumulator / fixedStep);
+        if (steps > maxSteps) {
+            // drop the time we cannot catch up on rather than falling further behind
+            steps = maxSteps;
+            accumulator = 0.0;
+        } else {
+            accumulator -= steps * fixedStep;
+        }
+        ticks += steps;
+        return steps;
+    }
+
+    // seconds since the clock started, as of the last tick()
+    double time() const { return last - start; }
+
+    // simulation time advanced in whole fixed steps
+    double stepTime() const { return ticks * fixedStep; }
+
+    // fraction of the next fixed step already elapsed, in [0, 1)
+    double alpha() const { return accumulator / fixedStep; }
+
+    // seconds taken by the last frame
+    double frameTime() const { return delta; }
+
+    // with immediate swaps, sleep until the next frame is due so the loop
+    // does not spin the CPU; synced swaps already block in glfwSwapBuffers
+    void limit()
+    {
+        if (swapMode != SWAP_IMMEDIATE || targetInterval <= 0.0)
+            return;
+        double wait = last + targetInterval - glfwGetTime();
+        if (wait > 0.0)
+            std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+    }
+
+    // true once per stats interval, when pacing() holds a new summary
+    bool pacingReady() const { return ready; }
+    const Pacing &pacing() const { return summary; }
+
+    // one line summary of the last interval, e.g. for the window title
+    std::string pacingText() const
+    {
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(2)
+          << summary.meanMs << " ms (" << summary.minMs << "-" << summary.maxMs
+          << ") jitter " << summary.jitterMs << " ms, " << summary.lateFrames << " late";
+        return s.str();
+    }
+
+private:
+    double start, last;
+    double delta          = 0.0;
+    double accumulator    = 0.0;
+    long   ticks          = 0;
+    double targetInterval = 0.0;
+    int    swapMode       = SWAP_VSYNC;
+
+    double interval;
+    double intervalStart  = -1.0;
+    int    frames;
+    double sumMs, sumSqMs, minMs, maxMs;
+    std::vector<double> frameMs;
+    Pacing summary;
+    bool   ready          = false;
+
+    void resetStats()
+    {
+        frames = 0;
+        sumMs = sumSqMs = 0.0;
+        minMs = 1.0e9;
+        maxMs = 0.0;
+        frameMs.clear();
+    }
+
+    void record(double seconds)
+    {
+        double ms = 1000.0 * seconds;
+        if (intervalStart < 0.0)
+            intervalStart = last;
+        frames++;
+        sumMs   += ms;
+        sumSqMs += ms * ms;
+        minMs    = std::min(minMs, ms);
+        maxMs    = std::max(maxMs, ms);
+        frameMs.push_back(ms);
+
+        ready = last - intervalStart >= interval;
+        if (!ready)
+            return;
+
+        summary.frames   = frames;
+        summary.meanMs   = sumMs / frames;
+        summary.minMs    = minMs;
+        summary.maxMs    = maxMs;
+        summary.jitterMs = std::sqrt(std::max(0.0, sumSqMs / frames - summary.meanMs * summary.meanMs));
+        // late relative to the target rate, or to the interval's mean when unlimited
+        double expectedMs = targetInterval > 0.0 ? 1000.0 * targetInterval : summary.meanMs;
+        summary.lateFrames = (int)std::count_if(frameMs.begin(), frameMs.end(),
+                                                [expectedMs](double f) { return f > 1.5 * expectedMs; });
+        resetStats();
+        intervalStart = last;
+    }
+};
+
+#endif
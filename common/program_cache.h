@@ -0,0 +1,292 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <cstdio>
+#include <cstdint>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// Disk cache of linked shader programs.
+//
+// A program is identified by a hash of its stage sources and of the driver
+// (vendor, renderer and version strings), so editing a shader or updating the
+// driver just misses. On a hit the program comes straight from the stored
+// glGetProgramBinary blob with glProgramBinary and nothing is compiled; on a
+// miss, or if the driver rejects the blob, the sources are compiled and linked
+// as usual and the new binary replaces the old file. Without program binary
+// support (GL < 4.1 and no ARB_get_program_binary) it only compiles.
+//
+//     std::vector<ProgramStage> stages;
+//     stages.push_back(ProgramStage(GL_VERTEX_SHADER, vertexSource));
+//     stages.push_back(ProgramStage(GL_FRAGMENT_SHADER, fragmentSource));
+//     GLuint program = ProgramCache::shared().build(stages, "TILE");
+//
+// build() is start() followed by finish(). Between the two the driver may
+// still be compiling (GL_KHR_parallel_shader_compile), so several programs can
+// be started before any of them is waited on.
+struct ProgramStage
+{
+    GLenum      type;
+    std::string source;
+
+    ProgramStage(GLenum stageType, const std::string &stageSource) : type(stageType), source(stageSource) {}
+};
+
+// a program between ProgramCache::start() and finish()
+struct PendingProgram
+{
+    GLuint              program;
+    std::vector<GLuint> shaders;        // empty when the program came from the cache
+    std::string         label;
+    bool                cached;
+    bool                binaries;
+    uint64_t            key, check;
+};
+
+class ProgramCache
+{
+public:
+    // programs taken from disk and programs compiled since startup
+    unsigned int hits;
+    unsigned int misses;
+
+    // cache files live in directory, created on first store; empty disables the cache
+    ProgramCache(const std::string &cacheDirectory = ".shader_cache")
+        : hits(0), misses(0), directory(cacheDirectory) {}
+
+    // the instance used by Shader, loadComputeShader() and the truchet programs
+    static ProgramCache &shared()
+    {
+        static ProgramCache cache;
+        return cache;
+    }
+
+    void setDirectory(const std::string &cacheDirectory) { directory = cacheDirectory; }
+
+    // linked program for the given stages, 0 if it does not compile or link;
+    // label only names the program in error messages
+    GLuint build(const std::vector<ProgramStage> &stages, const std::string &label)
+    {
+        PendingProgram pending = start(stages, label);
+        return finish(pending);
+    }
+
+    // load the program from disk, or submit its stages for compiling and linking
+    // without waiting for the result
+    PendingProgram start(const std::vector<ProgramStage> &stages, const std::string &label)
+    {
+        PendingProgram pending;
+        pending.label    = label;
+        pending.cached   = false;
+        pending.binaries = enabled();
+        pending.key      = 0;
+        pending.check    = 0;
+        if (pending.binaries) {
+            hashKey(stages, pending.key, pending.check);
+            pending.program = load(pending.key, pending.check);
+            if (pending.program != 0) {
+                pending.cached = true;
+                return pending;
+            }
+        }
+
+        pending.program = glCreateProgram();
+        for (size_t s = 0; s < stages.size(); s++) {
+            const char *source = stages[s].source.c_str();
+            GLuint shaderID = glCreateShader(stages[s].type);
+            glShaderSource(shaderID, 1, &source, NULL);
+            glCompileShader(shaderID);
+            glAttachShader(pending.program, shaderID);
+            pending.shaders.push_back(shaderID);
+        }
+        if (pending.binaries)
+            glProgramParameteri(pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(pending.program);
+        return pending;
+    }
+
+    // wait for a started program, report its errors and store its binary;
+    // the linked program or 0
+    GLuint finish(PendingProgram &pending)
+    {
+        if (pending.cached) {
+            hits++;
+            return pending.program;
+        }
+
+        misses++;
+        int success;
+        char infoLog[1024];
+        bool compiled = true;
+        for (size_t s = 0; s < pending.shaders.size(); s++) {
+            glGetShaderiv(pending.shaders[s], GL_COMPILE_STATUS, &success);
+            if (!success) {
+                GLint type;
+                glGetShaderiv(pending.shaders[s], GL_SHADER_TYPE, &type);
+                glGetShaderInfoLog(pending.shaders[s], 1024, NULL, infoLog);
+                std::cout << "ERROR::SHADER::" << pending.label << "::" << stageName(type)
+                          << "::COMPILATION_FAILED\n" << infoLog << std::endl;
+                compiled = false;
+            }
+        }
+        if (compiled) {
+            glGetProgramiv(pending.program, GL_LINK_STATUS, &success);
+            if (!success) {
+                glGetProgramInfoLog(pending.program, 1024, NULL, infoLog);
+                std::cout << "ERROR::SHADER::" << pending.label << "::LINKING_FAILED\n" << infoLog << std::endl;
+                compiled = false;
+            }
+        }
+
+        for (size_t s = 0; s < pending.shaders.size(); s++)
+            glDeleteShader(pending.shaders[s]);
+        pending.shaders.clear();
+        if (!compiled) {
+            glDeleteProgram(pending.program);
+            pending.program = 0;
+        } else if (pending.binaries) {
+            store(pending.program, pending.key, pending.check);
+        }
+        return pending.program;
+    }
+
+private:
+    std::string directory;
+
+    static const uint32_t MAGIC   = 0x42475250;    // "PRGB"
+    static const uint32_t VERSION = 1;
+
+    bool enabled() const
+    {
+        if (directory.empty() || glGetProgramBinary == NULL || glProgramBinary == NULL || glProgramParameteri == NULL)
+            return false;
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        return formats > 0;
+    }
+
+    // 64 bit FNV-1a
+    static uint64_t fnv(uint64_t hash, const void *data, size_t length)
+    {
+        const unsigned char *bytes = (const unsigned char *)data;
+        for (size_t i = 0; i < length; i++) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // key names the file, check (a second hash with another basis) guards against collisions
+    static void hashKey(const std::vector<ProgramStage> &stages, uint64_t &key, uint64_t &check)
+    {
+        std::string driver;
+        const GLenum strings[4] = { GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION };
+        for (int s = 0; s < 4; s++) {
+            const GLubyte *value = glGetString(strings[s]);
+            driver += value ? (const char *)value : "";
+            driver += '\n';
+        }
+        key   = fnv(0xcbf29ce484222325ull, driver.data(), driver.size());
+        check = fnv(0x84222325cbf29ce4ull, driver.data(), driver.size());
+        for (size_t s = 0; s < stages.size(); s++) {
+            uint32_t header[2] = { (uint32_t)stages[s].type, (uint32_t)stages[s].source.size() };
+            key   = fnv(fnv(key, header, sizeof(header)), stages[s].source.data(), stages[s].source.size());
+            check = fnv(fnv(check, header, sizeof(header)), stages[s].source.data(), stages[s].source.size());
+        }
+    }
+
+    std::string path(uint64_t key) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return directory + "/" + name;
+    }
+
+    // program from the cache file, 0 if there is none or the driver rejects it
+    GLuint load(uint64_t key, uint64_t check) const
+    {
+        std::ifstream file(path(key).c_str(), std::ios::binary);
+        if (!file.is_open())
+            return 0;
+
+        uint32_t header[4];         // magic, version, binary format, length
+        uint64_t storedCheck;
+        file.read((char *)header, sizeof(header));
+        file.read((char *)&storedCheck, sizeof(storedCheck));
+        if (!file || header[0] != MAGIC || header[1] != VERSION || storedCheck != check)
+            return 0;
+        // the blob runs to the end of the file; a length that disagrees means a
+        // truncated or corrupt entry, which must not size the allocation
+        std::streamoff blobStart = file.tellg();
+        file.seekg(0, std::ios::end);
+        std::streamoff blobSize = file.tellg() - blobStart;
+        file.seekg(blobStart);
+        if (!file || header[3] == 0 || blobSize != (std::streamoff)header[3])
+            return 0;
+        std::vector<char> binary(header[3]);
+        file.read(binary.data(), binary.size());
+        if (!file)
+            return 0;
+
+        GLuint programID = glCreateProgram();
+        glProgramBinary(programID, (GLenum)header[2], binary.data(), (GLsizei)binary.size());
+        GLint success = 0;
+        glGetProgramiv(programID, GL_LINK_STATUS, &success);
+        if (!success) {
+            glDeleteProgram(programID);
+            return 0;
+        }
+        return programID;
+    }
+
+    // write the linked program's binary, through a temporary file so a crash never leaves half a blob
+    void store(GLuint programID, uint64_t key, uint64_t check) const
+    {
+        GLint length = 0;
+        glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+        std::vector<char> binary(length);
+        GLenum format = 0;
+        glGetProgramBinary(programID, length, &length, &format, binary.data());
+
+#ifdef _WIN32
+        _mkdir(directory.c_str());
+#else
+        mkdir(directory.c_str(), 0755);
+#endif
+        std::string target    = path(key);
+        std::string temporary = target + ".tmp";
+        std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            return;
+        uint32_t header[4] = { MAGIC, VERSION, (uint32_t)format, (uint32_t)length };
+        file.write((const char *)header, sizeof(header));
+        file.write((const char *)&check, sizeof(check));
+        file.write(binary.data(), length);
+        file.close();
+        if (file.fail() || std::rename(temporary.c_str(), target.c_str()) != 0)
+            std::remove(temporary.c_str());
+    }
+
+    static const char *stageName(GLenum type)
+    {
+        switch (type) {
+            case GL_VERTEX_SHADER:   return "VERTEX";
+            case GL_FRAGMENT_SHADER: return "FRAGMENT";
+            case GL_GEOMETRY_SHADER: return "GEOMETRY";
+            case GL_COMPUTE_SHADER:  return "COMPUTE";
+            default:                 return "UNKNOWN";
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,321 @@
+#ifndef SHADER_RELOADER_H
+#define SHADER_RELOADER_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <program_cache.h>
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+// GL_KHR_parallel_shader_compile, not in our glad
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR           0x91B1
+
+// Hot reloading of shader programs while the application keeps running.
+//
+// A loader thread owns a hidden window whose context shares objects with the
+// main one. It watches the source files of every registered program (inotify
+// on Linux, modification times elsewhere) and when one changes it rebuilds the
+// programs using it through ProgramCache. With GL_KHR_parallel_shader_compile
+// all changed programs are compiled at once on the driver's threads. Nothing is
+// replaced until update() is called on the main thread, between frames, which
+// hands each new program to its install callback; a program that fails to
+// build is reported and the old one stays in use.
+//
+//     reloader.watch(files, "COMPUTE", readSources, [&](GLuint program) {
+//         glDeleteProgram(computeProgramID);
+//         computeProgramID = program;
+//     });
+//     while (...) { reloader.update(); ... }
+class ShaderReloader
+{
+public:
+    // fills in the stages to build from the current files, false if one can't be read; runs on the loader thread
+    typedef std::function<bool(std::vector<ProgramStage> &)> SourceFunction;
+    // takes over a rebuilt program; runs on the main thread inside update()
+    typedef std::function<void(GLuint)> InstallFunction;
+
+    // window is the main window, whose context must be current; call from the main thread
+    ShaderReloader(GLFWwindow *window) : loaderWindow(NULL), running(false), parallel(false)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        loaderWindow = glfwCreateWindow(1, 1, "shader loader", NULL, window);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+        if (loaderWindow == NULL)
+            std::cout << "ERROR::SHADER_RELOADER::NO_SHARED_CONTEXT, shaders will not be reloaded" << std::endl;
+    }
+    ~ShaderReloader()
+    {
+        if (running) {
+            running = false;
+            loader.join();
+        }
+        if (loaderWindow != NULL)
+            glfwDestroyWindow(loaderWindow);
+    }
+    ShaderReloader(const ShaderReloader &) = delete;
+    ShaderReloader &operator=(const ShaderReloader &) = delete;
+
+    // rebuild a program whenever one of files changes; register everything before start()
+    void watch(const std::vector<std::string> &files, const std::string &label,
+               SourceFunction sources, InstallFunction install)
+    {
+        struct program p;
+        p.files   = files;
+        p.label   = label;
+        p.sources = sources;
+        p.install = install;
+        programs.push_back(p);
+    }
+
+    // start watching the files
+    void start()
+    {
+        if (loaderWindow == NULL || running)
+            return;
+        running = true;
+        loader  = std::thread(&ShaderReloader::run, this);
+    }
+
+    // install programs finished since the last call; call between frames
+    void update()
+    {
+        std::vector<std::pair<size_t, GLuint> > done;
+        {
+            std::lock_guard<std::mutex> lock(finishedMutex);
+            done.swap(finished);
+        }
+        for (size_t d = 0; d < done.size(); d++) {
+            programs[done[d].first].install(done[d].second);
+            std::cout << "Reloaded " << programs[done[d].first].label << std::endl;
+        }
+    }
+
+    // whole file into source, false if it can't be opened
+    static bool readFile(const std::string &path, std::string &source)
+    {
+        std::ifstream file(path.c_str());
+        if (!file.is_open())
+            return false;
+        std::stringstream stream;
+        stream << file.rdbuf();
+        source = stream.str();
+        return true;
+    }
+
+private:
+    struct program {
+        std::vector<std::string> files;
+        std::string              label;
+        SourceFunction           sources;
+        InstallFunction          install;
+    };
+
+    GLFWwindow          *loaderWindow;
+    std::thread          loader;
+    std::atomic<bool>    running;
+    bool                 parallel;
+    std::vector<program> programs;
+
+    std::mutex                               finishedMutex;
+    std::vector<std::pair<size_t, GLuint> >  finished;     // program index, new program
+
+    // loader thread: wait for changes, let them settle, rebuild
+    void run()
+    {
+        glfwMakeContextCurrent(loaderWindow);
+        parallel = glfwExtensionSupported("GL_KHR_parallel_shader_compile") == GLFW_TRUE;
+        if (parallel) {
+            typedef void (*MaxThreadsFunction)(GLuint);
+            MaxThreadsFunction maxThreads = (MaxThreadsFunction)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+            if (maxThreads != NULL)
+                maxThreads(0xFFFFFFFF);     // as many as the driver likes
+        }
+
+        std::vector<std::string> files;
+        for (size_t p = 0; p < programs.size(); p++)
+            files.insert(files.end(), programs[p].files.begin(), programs[p].files.end());
+        FileWatcher watcher(files);
+
+        std::vector<std::string> changed;
+        while (running) {
+            if (!watcher.wait(100, changed))
+                continue;
+            // editors save in several steps, collect everything written in the next moment
+            while (watcher.wait(50, changed)) {}
+            rebuild(changed);
+            changed.clear();
+        }
+        glfwMakeContextCurrent(NULL);
+    }
+
+    void rebuild(const std::vector<std::string> &changed)
+    {
+        std::vector<size_t>         indices;
+        std::vector<PendingProgram> pending;
+        for (size_t p = 0; p < programs.size(); p++) {
+            bool affected = false;
+            for (size_t f = 0; f < programs[p].files.size(); f++)
+                for (size_t c = 0; c < changed.size(); c++)
+                    affected |= sameFile(programs[p].files[f], changed[c]);
+            if (!affected)
+                continue;
+            std::vector<ProgramStage> stages;
+            if (!programs[p].sources(stages)) {
+                std::cout << "ERROR::SHADER_RELOADER::" << programs[p].label << "::FILE_NOT_SUCCESFULLY_READ" << std::endl;
+                continue;
+            }
+            indices.push_back(p);
+            pending.push_back(ProgramCache::shared().start(stages, programs[p].label));
+        }
+
+        // without the extension the status queries in finish() simply block
+        for (size_t n = 0; parallel && n < pending.size(); n++) {
+            GLint complete = GL_TRUE;
+            while (!pending[n].cached && running) {
+                glGetProgramiv(pending[n].program, GL_COMPLETION_STATUS_KHR, &complete);
+                if (complete)
+                    break;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        std::vector<std::pair<size_t, GLuint> > built;
+        for (size_t n = 0; n < pending.size(); n++) {
+            GLuint programID = ProgramCache::shared().finish(pending[n]);
+            if (programID != 0)
+                built.push_back(std::make_pair(indices[n], programID));
+            else
+                std::cout << "Keeping the previous " << programs[indices[n]].label << " program" << std::endl;
+        }
+        // the new programs must be complete before another context uses them
+        glFinish();
+
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        finished.insert(finished.end(), built.begin(), built.end());
+    }
+
+    static std::string baseName(const std::string &path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    static std::string directoryName(const std::string &path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? "." : path.substr(0, slash);
+    }
+
+    static bool sameFile(const std::string &a, const std::string &b)
+    {
+        return directoryName(a) == directoryName(b) && baseName(a) == baseName(b);
+    }
+
+    // reports watched files that were written, renamed into place or touched
+    class FileWatcher
+    {
+    public:
+        FileWatcher(const std::vector<std::string> &paths) : files(paths)
+        {
+#ifdef __linux__
+            // watch directories rather than files, editors often replace the file on save
+            fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            for (size_t f = 0; fd >= 0 && f < files.size(); f++) {
+                std::string directory = directoryName(files[f]);
+                bool known = false;
+                for (size_t w = 0; w < watches.size(); w++)
+                    known |= watches[w].second == directory;
+                if (known)
+                    continue;
+                int wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+                if (wd >= 0)
+                    watches.push_back(std::make_pair(wd, directory));
+            }
+#endif
+            for (size_t f = 0; f < files.size(); f++)
+                times.push_back(modified(files[f]));
+        }
+        ~FileWatcher()
+        {
+#ifdef __linux__
+            if (fd >= 0)
+                close(fd);
+#endif
+        }
+
+        // wait up to timeout milliseconds, appending watched files that changed; false if none did
+        bool wait(int timeout, std::vector<std::string> &changed)
+        {
+            size_t before = changed.size();
+#ifdef __linux__
+            if (fd >= 0) {
+                struct pollfd p = { fd, POLLIN, 0 };
+                if (poll(&p, 1, timeout) <= 0)
+                    return false;
+                alignas(struct inotify_event) char buffer[4096];
+                ssize_t length;
+                while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+                    for (char *e = buffer; e < buffer + length; ) {
+                        const struct inotify_event *event = (const struct inotify_event *)e;
+                        e += sizeof(struct inotify_event) + event->len;
+                        if (event->len == 0)
+                            continue;
+                        for (size_t w = 0; w < watches.size(); w++) {
+                            if (watches[w].first != event->wd)
+                                continue;
+                            std::string path = watches[w].second + "/" + event->name;
+                            for (size_t f = 0; f < files.size(); f++)
+                                if (sameFile(files[f], path))
+                                    changed.push_back(files[f]);
+                        }
+                    }
+                }
+                return changed.size() > before;
+            }
+#endif
+            // no inotify: compare modification times
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+            for (size_t f = 0; f < files.size(); f++) {
+                double t = modified(files[f]);
+                if (t != times[f]) {
+                    times[f] = t;
+                    changed.push_back(files[f]);
+                }
+            }
+            return changed.size() > before;
+        }
+
+    private:
+        std::vector<std::string> files;
+        std::vector<double>      times;
+#ifdef __linux__
+        int fd;
+        std::vector<std::pair<int, std::string> > watches;
+#endif
+
+        static double modified(const std::string &path)
+        {
+            struct stat info;
+            return stat(path.c_str(), &info) == 0 ? (double)info.st_mtime : 0.0;
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef UNIFORM_BUFFER_H
+#define UNIFORM_BUFFER_H
+
+#include <glad/glad.h>
+
+// Typed uniform buffer object holding one std140 block.
+//
+// T must mirror the GLSL block's std140 layout: vec3 and scalars packed to
+// 16 byte boundaries by hand, mat4/vec4 members as-is. For example
+//
+//     layout (std140) uniform Camera { mat4 view; mat4 projection; };
+//     struct Camera { glm::mat4 view; glm::mat4 projection; };
+//
+// Upload once per frame with update() and every program bound to the same
+// binding point sees the new values.
+template <typename T>
+class UniformBuffer
+{
+public:
+    static_assert(sizeof(T) % 16 == 0, "std140 blocks are padded to a multiple of 16 bytes");
+
+    unsigned int ID;
+    unsigned int binding;
+
+    UniformBuffer(unsigned int bindingPoint) : binding(bindingPoint)
+    {
+        glGenBuffers(1, &ID);
+        glBindBuffer(GL_UNIFORM_BUFFER, ID);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(T), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, ID);
+    }
+    ~UniformBuffer()
+    {
+        glDeleteBuffers(1, &ID);
+    }
+    UniformBuffer(const UniformBuffer &) = delete;
+    UniformBuffer &operator=(const UniformBuffer &) = delete;
+
+    // replace the whole block
+    void update(const T &data)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, ID);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(T), &data);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    // connect the named block of a linked program to this buffer's binding point
+    bool attach(unsigned int programID, const char *blockName) const
+    {
+        unsigned int index = glGetUniformBlockIndex(programID, blockName);
+        if (index == GL_INVALID_INDEX)
+            return false;
+        glUniformBlockBinding(programID, index, binding);
+        return true;
+    }
+};
+
+#endif
@@ -2,6 +2,7 @@
 
 #include "setup.hpp"
 #include <limits>
+#include <cmath>
 
 namespace glm{
 namespace detail
@@ -46,5 +47,135 @@ namespace detail
 			return x;
 		}
 	};
+
+#	if GLM_HAS_IS_CONSTANT_EVALUATED
+	// <cmath> isn't constexpr: when a transform is constant evaluated, its square roots
+	// and trigonometric functions are computed by series in long double instead.
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T compute_sqrt_series(T x)
+	{
+		typedef long double wide;
+
+		if(!(x > static_cast<T>(0)) || x > std::numeric_limits<T>::max())
+			return x == static_cast<T>(0) || x > std::numeric_limits<T>::max() ? x : std::numeric_limits<T>::quiet_NaN();
+
+		// Newton iterations from above decrease monotonically to the root
+		wide const Value = static_cast<wide>(x);
+		wide Root = Value > static_cast<wide>(1) ? Value : static_cast<wide>(1);
+		for(wide Next = (Root + Value / Root) / static_cast<wide>(2); Next < Root; Next = (Root + Value / Root) / static_cast<wide>(2))
+			Root = Next;
+		return static_cast<T>(Root);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR void compute_sincos_series(T x, T& s, T& c)
+	{
+		typedef long double wide;
+
+		wide const Pi = static_cast<wide>(3.141592653589793238462643383279502884L);
+		wide const HalfPi = Pi / static_cast<wide>(2);
+		wide const TwoPi = Pi * static_cast<wide>(2);
+
+		// infinities and NaN have no angle
+		if(!(x - x == static_cast<T>(0)))
+		{
+			s = c = std::numeric_limits<T>::quiet_NaN();
+			return;
+		}
+
+		// |x| mod 2 pi like fmod: subtracting power of two multiples of 2 pi from the
+		// largest down is exact, so any finite x reduces without an integer cast
+		wide Angle = x < static_cast<T>(0) ? -static_cast<wide>(x) : static_cast<wide>(x);
+		if(Angle >= TwoPi)
+		{
+			wide Multiple = TwoPi;
+			while(Multiple * static_cast<wide>(2) <= Angle)
+				Multiple *= static_cast<wide>(2);
+			for(; Multiple >= TwoPi; Multiple /= static_cast<wide>(2))
+				if(Angle >= Multiple)
+					Angle -= Multiple;
+		}
+
+		// to [-pi, pi] and then to [-pi/2, pi/2], where cos is positive
+		if(Angle > Pi)
+			Angle -= TwoPi;
+		if(x < static_cast<T>(0))
+			Angle = -Angle;
+		wide CosSign = static_cast<wide>(1);
+		if(Angle > HalfPi || Angle < -HalfPi)
+		{
+			Angle = (Angle > static_cast<wide>(0) ? Pi : -Pi) - Angle;
+			CosSign = static_cast<wide>(-1);
+		}
+
+		wide const Square = Angle * Angle;
+		wide Sin = Angle, SinTerm = Angle;
+		wide Cos = static_cast<wide>(1), CosTerm = static_cast<wide>(1);
+		for(int i = 1; i < 32; ++i)
+		{
+			SinTerm *= -Square / static_cast<wide>((2 * i) * (2 * i + 1));
+			CosTerm *= -Square / static_cast<wide>((2 * i - 1) * (2 * i));
+			if(Sin + SinTerm == Sin && Cos + CosTerm == Cos)
+				break;
+			Sin += SinTerm;
+			Cos += CosTerm;
+		}
+
+		s = static_cast<T>(Sin);
+		c = static_cast<T>(Cos * CosSign);
+	}
+#	endif//GLM_HAS_IS_CONSTANT_EVALUATED
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sqrt(T x)
+	{
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+				return compute_sqrt_series(x);
+#		endif
+		return std::sqrt(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_sin(T x)
+	{
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+			{
+				T s = static_cast<T>(0), c = static_cast<T>(0);
+				compute_sincos_series(x, s, c);
+				return s;
+			}
+#		endif
+		return std::sin(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_cos(T x)
+	{
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+			{
+				T s = static_cast<T>(0), c = static_cast<T>(0);
+				compute_sincos_series(x, s, c);
+				return c;
+			}
+#		endif
+		return std::cos(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR T constexpr_tan(T x)
+	{
+#		if GLM_HAS_IS_CONSTANT_EVALUATED
+			if(__builtin_is_constant_evaluated())
+			{
+				T s = static_cast<T>(0), c = static_cast<T>(0);
+				compute_sincos_series(x, s, c);
+				return s / c;
+			}
+#		endif
+		return std::tan(x);
+	}
 }//namespace detail
 }//namespace glm
@@ -31,6 +31,76 @@ namespace detail
 		}
 	};
 #	endif
+
+#	if GLM_CONFIG_FAST_MATH == GLM_ENABLE
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<qualifier Q>
+	struct compute_exp<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pow<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& base, vec<4, double, Q> const& exponent)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+#		endif
+#	endif
 }//namespace detail
 }//namespace glm
 
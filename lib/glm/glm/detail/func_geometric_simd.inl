@@ -93,6 +93,66 @@ namespace detail
 			return Result;
 		}
 	};
+
+	template<qualifier Q>
+	struct compute_dot<vec<2, double, Q>, double, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<2, double, Q> const& x, vec<2, double, Q> const& y)
+		{
+			return _mm_cvtsd_f64(glm_dvec2_dot(x.data, y.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_normalize<2, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<2, double, Q> call(vec<2, double, Q> const& v)
+		{
+			vec<2, double, Q> Result;
+			Result.data = glm_dvec2_normalize(v.data);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_length<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& v)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_length(v.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_distance<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& p0, vec<4, double, Q> const& p1)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_length(_mm256_sub_pd(p1.data, p0.data)));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_dot<vec<4, double, Q>, double, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_dot(x.data, y.data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_normalize<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_normalize(v.data);
+			return Result;
+		}
+	};
+#	endif
 }//namespace detail
 }//namespace glm
 
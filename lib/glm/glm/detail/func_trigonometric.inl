@@ -2,8 +2,37 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::sin, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::cos, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_atan2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& y, vec<L, T, Q> const& x)
+		{
+			return detail::functor2<vec, L, T, Q>::call(::std::atan2, y, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template<typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -40,7 +69,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> sin(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(sin, v);
+		return detail::compute_sin<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// cos
@@ -49,7 +78,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> cos(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(cos, v);
+		return detail::compute_cos<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// tan
@@ -91,7 +120,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> atan(vec<L, T, Q> const& a, vec<L, T, Q> const& b)
 	{
-		return detail::functor2<vec, L, T, Q>::call(::std::atan2, a, b);
+		return detail::compute_atan2<L, T, Q, detail::is_aligned<Q>::value>::call(a, b);
 	}
 
 	using std::atan;
@@ -0,0 +1,81 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_CONFIG_FAST_MATH == GLM_ENABLE)
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& y, vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<qualifier Q>
+	struct compute_sin<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan2<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& y, vec<4, double, Q> const& x)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_CONFIG_FAST_MATH == GLM_ENABLE)
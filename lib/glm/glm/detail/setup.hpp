@@ -274,7 +274,7 @@
 
 // N2235 Generalized Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2235.pdf
 // N3652 Extended Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3652.html
-#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) // Compiler SIMD intrinsics don't support constexpr...
+#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) && (defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES) || defined(GLM_FORCE_ALIGNED)) // Every vec4 operation goes through intrinsics, which don't support constexpr
 #	define GLM_HAS_CONSTEXPR 0
 #elif (GLM_COMPILER & GLM_COMPILER_CLANG)
 #	define GLM_HAS_CONSTEXPR __has_feature(cxx_relaxed_constexpr)
@@ -315,6 +315,20 @@
 #	define GLM_IF_CONSTEXPR if
 #endif
 
+// P0595 std::is_constant_evaluated http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2019/p0595r2.html
+// The builtin behind it is available in every language mode with GCC 9, Clang 9 and Visual C++ 2019 16.5
+#if !GLM_HAS_CONSTEXPR
+#	define GLM_HAS_IS_CONSTANT_EVALUATED 0
+#elif (GLM_COMPILER & GLM_COMPILER_CLANG) && defined(__has_builtin)
+#	define GLM_HAS_IS_CONSTANT_EVALUATED __has_builtin(__builtin_is_constant_evaluated)
+#elif (GLM_COMPILER & GLM_COMPILER_GCC) && (__GNUC__ >= 9)
+#	define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#elif (GLM_COMPILER & GLM_COMPILER_VC) && (_MSC_VER >= 1925)
+#	define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#else
+#	define GLM_HAS_IS_CONSTANT_EVALUATED 0
+#endif
+
 //
 #if GLM_LANG & GLM_LANG_CXX11_FLAG
 #	define GLM_HAS_ASSIGNABLE 1
@@ -807,6 +821,15 @@ namespace detail
 #	define GLM_CONFIG_SIMD GLM_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Use polynomial approximations for the transcendental functions of SIMD vectors
+
+#ifdef GLM_FORCE_FAST_MATH
+#	define GLM_CONFIG_FAST_MATH GLM_ENABLE
+#else
+#	define GLM_CONFIG_FAST_MATH GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Configure the use of defaulted function
 
@@ -977,7 +1000,12 @@ namespace detail
 #	endif
 
 	// Report build target
-#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
+#	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
 #		pragma message("GLM: x86 32 bits with AVX2 instruction set build target")
@@ -1119,6 +1147,10 @@ namespace detail
 #		endif
 #	endif
 
+#	if GLM_CONFIG_FAST_MATH == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_FAST_MATH is defined. Aligned vec4 and dvec4 transcendental functions use SIMD polynomial approximations.")
+#	endif
+
 #	if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
 #		pragma message("GLM: GLM_FORCE_DEPTH_ZERO_TO_ONE is defined. Using zero to one depth clip space.")
 #	else
@@ -370,8 +370,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> operator*(qua<T, Q> const& q, T const& s)
 	{
-		return qua<T, Q>(
-			q.w * s, q.x * s, q.y * s, q.z * s);
+		return qua<T, Q>(q) *= s;
 	}
 
 	template<typename T, qualifier Q>
@@ -383,8 +382,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> operator/(qua<T, Q> const& q, T const& s)
 	{
-		return qua<T, Q>(
-			q.w / s, q.x / s, q.y / s, q.z / s);
+		return qua<T, Q>(q) /= s;
 	}
 
 	// -- Boolean operators --
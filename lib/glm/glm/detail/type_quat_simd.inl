@@ -89,7 +89,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, qua<float, Q> const& p)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_sub_ps(q.data, p.data);
 			return Result;
 		}
@@ -113,7 +113,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_mul_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -126,7 +126,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_mul_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_mul_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -137,7 +137,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_div_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -150,12 +150,14 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_div_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_div_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
 #	endif
 
+	// the shuffles below expect the x, y, z, w storage order
+#	ifndef GLM_FORCE_QUAT_DATA_WXYZ
 	template<qualifier Q>
 	struct compute_quat_mul_vec4<float, Q, true>
 	{
@@ -177,10 +179,48 @@ namespace detail
 			uuv = _mm_mul_ps(uuv, two);
 
 			vec<4, float, Q> Result;
-			Result.data = _mm_add_ps(v.Data, _mm_add_ps(uv, uuv));
+			Result.data = _mm_add_ps(v.data, _mm_add_ps(uv, uuv));
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<qualifier Q>
+	struct compute_quat_mul_vec4<double, Q, true>
+	{
+		static vec<4, double, Q> call(qua<double, Q> const& q, vec<4, double, Q> const& v)
+		{
+			__m256d const q_wwww = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(3, 3, 3, 3));
+			__m256d const q_swp0 = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256d const q_swp1 = _mm256_permute4x64_pd(q.data, _MM_SHUFFLE(3, 1, 0, 2));
+			__m256d const v_swp0 = _mm256_permute4x64_pd(v.data, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256d const v_swp1 = _mm256_permute4x64_pd(v.data, _MM_SHUFFLE(3, 1, 0, 2));
+
+			// plain mul and sub for the cross products so that their w stays exactly 0
+			__m256d const uv      = _mm256_sub_pd(_mm256_mul_pd(q_swp0, v_swp1), _mm256_mul_pd(q_swp1, v_swp0));
+			__m256d const uv_swp0 = _mm256_permute4x64_pd(uv, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256d const uv_swp1 = _mm256_permute4x64_pd(uv, _MM_SHUFFLE(3, 1, 0, 2));
+			__m256d const uuv     = _mm256_sub_pd(_mm256_mul_pd(q_swp0, uv_swp1), _mm256_mul_pd(q_swp1, uv_swp0));
+
+			// v + ((uv * w) + uuv) * 2
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_fma(glm_dvec4_fma(uv, q_wwww, uuv), _mm256_set1_pd(2.0), v.data);
 			return Result;
 		}
 	};
+#	endif
+#	endif//GLM_FORCE_QUAT_DATA_WXYZ
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_dot<qua<double, Q>, double, true>
+	{
+		static double call(qua<double, Q> const& a, qua<double, Q> const& b)
+		{
+			return _mm256_cvtsd_f64(glm_dvec4_dot(a.data, b.data));
+		}
+	};
+#	endif
 }//namespace detail
 }//namespace glm
 
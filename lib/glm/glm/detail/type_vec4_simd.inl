@@ -344,120 +344,124 @@ namespace detail
 #	endif
 }//namespace detail
 
+	// Intrinsics aren't constant expressions: with constexpr enabled the generic
+	// constructors are used instead, which compile to the same broadcasts and packs.
+#	if GLM_CONFIG_CONSTEXP == GLM_DISABLE
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(float _s) :
 		data(_mm_set1_ps(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(float _s) :
 		data(_mm_set1_ps(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(float _s) :
 		data(_mm_set1_ps(_s))
 	{}
 
 #	if GLM_ARCH & GLM_ARCH_AVX_BIT
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, aligned_lowp>::vec(double _s) :
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_lowp>::vec(double _s) :
 		data(_mm256_set1_pd(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, aligned_mediump>::vec(double _s) :
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_mediump>::vec(double _s) :
 		data(_mm256_set1_pd(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, double, aligned_highp>::vec(double _s) :
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_highp>::vec(double _s) :
 		data(_mm256_set1_pd(_s))
 	{}
 #	endif
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_lowp>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_lowp>::vec(int _s) :
 		data(_mm_set1_epi32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_mediump>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_mediump>::vec(int _s) :
 		data(_mm_set1_epi32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_highp>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_highp>::vec(int _s) :
 		data(_mm_set1_epi32(_s))
 	{}
 
 #	if GLM_ARCH & GLM_ARCH_AVX2_BIT
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, detail::int64, aligned_lowp>::vec(detail::int64 _s) :
+	GLM_FUNC_QUALIFIER vec<4, detail::int64, aligned_lowp>::vec(detail::int64 _s) :
 		data(_mm256_set1_epi64x(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, detail::int64, aligned_mediump>::vec(detail::int64 _s) :
+	GLM_FUNC_QUALIFIER vec<4, detail::int64, aligned_mediump>::vec(detail::int64 _s) :
 		data(_mm256_set1_epi64x(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, detail::int64, aligned_highp>::vec(detail::int64 _s) :
+	GLM_FUNC_QUALIFIER vec<4, detail::int64, aligned_highp>::vec(detail::int64 _s) :
 		data(_mm256_set1_epi64x(_s))
 	{}
 #	endif
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(float _x, float _y, float _z, float _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(float _x, float _y, float _z, float _w) :
 		data(_mm_set_ps(_w, _z, _y, _x))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(float _x, float _y, float _z, float _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(float _x, float _y, float _z, float _w) :
 		data(_mm_set_ps(_w, _z, _y, _x))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(float _x, float _y, float _z, float _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(float _x, float _y, float _z, float _w) :
 		data(_mm_set_ps(_w, _z, _y, _x))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_set_epi32(_w, _z, _y, _x))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_set_epi32(_w, _z, _y, _x))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_set_epi32(_w, _z, _y, _x))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_cvtepi32_ps(_mm_set_epi32(_w, _z, _y, _x)))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_cvtepi32_ps(_mm_set_epi32(_w, _z, _y, _x)))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
 		data(_mm_cvtepi32_ps(_mm_set_epi32(_w, _z, _y, _x)))
 	{}
+#	endif//GLM_CONFIG_CONSTEXP == GLM_DISABLE
 }//namespace glm
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -668,104 +672,104 @@ namespace detail {
 
 }//namespace detail
 
-#if !GLM_CONFIG_XYZW_ONLY
+#if !GLM_CONFIG_XYZW_ONLY && GLM_CONFIG_CONSTEXP == GLM_DISABLE
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(float _s) :
 		data(vdupq_n_f32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(float _s) :
 		data(vdupq_n_f32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(float _s) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(float _s) :
 		data(vdupq_n_f32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_lowp>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_lowp>::vec(int _s) :
 		data(vdupq_n_s32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_mediump>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_mediump>::vec(int _s) :
 		data(vdupq_n_s32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, int, aligned_highp>::vec(int _s) :
+	GLM_FUNC_QUALIFIER vec<4, int, aligned_highp>::vec(int _s) :
 		data(vdupq_n_s32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, uint, aligned_lowp>::vec(uint _s) :
+	GLM_FUNC_QUALIFIER vec<4, uint, aligned_lowp>::vec(uint _s) :
 		data(vdupq_n_u32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, uint, aligned_mediump>::vec(uint _s) :
+	GLM_FUNC_QUALIFIER vec<4, uint, aligned_mediump>::vec(uint _s) :
 		data(vdupq_n_u32(_s))
 	{}
 
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, uint, aligned_highp>::vec(uint _s) :
+	GLM_FUNC_QUALIFIER vec<4, uint, aligned_highp>::vec(uint _s) :
 		data(vdupq_n_u32(_s))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(const vec<4, float, aligned_highp>& rhs) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(const vec<4, float, aligned_highp>& rhs) :
 		data(rhs.data)
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(const vec<4, int, aligned_highp>& rhs) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(const vec<4, int, aligned_highp>& rhs) :
 		data(vcvtq_f32_s32(rhs.data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(const vec<4, uint, aligned_highp>& rhs) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(const vec<4, uint, aligned_highp>& rhs) :
 		data(vcvtq_f32_u32(rhs.data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(int _x, int _y, int _z, int _w) :
 		data(vcvtq_f32_s32(vec<4, int, aligned_lowp>(_x, _y, _z, _w).data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(int _x, int _y, int _z, int _w) :
 		data(vcvtq_f32_s32(vec<4, int, aligned_mediump>(_x, _y, _z, _w).data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(int _x, int _y, int _z, int _w) :
 		data(vcvtq_f32_s32(vec<4, int, aligned_highp>(_x, _y, _z, _w).data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_lowp>::vec(uint _x, uint _y, uint _z, uint _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp>::vec(uint _x, uint _y, uint _z, uint _w) :
 		data(vcvtq_f32_u32(vec<4, uint, aligned_lowp>(_x, _y, _z, _w).data))
 	{}
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_mediump>::vec(uint _x, uint _y, uint _z, uint _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump>::vec(uint _x, uint _y, uint _z, uint _w) :
 		data(vcvtq_f32_u32(vec<4, uint, aligned_mediump>(_x, _y, _z, _w).data))
 	{}
 
 
 	template<>
 	template<>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<4, float, aligned_highp>::vec(uint _x, uint _y, uint _z, uint _w) :
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp>::vec(uint _x, uint _y, uint _z, uint _w) :
 		data(vcvtq_f32_u32(vec<4, uint, aligned_highp>(_x, _y, _z, _w).data))
 	{}
 
@@ -13,6 +13,10 @@
 /// https://github.com/ashima/webgl-noise
 /// Following Stefan Gustavson's paper "Simplex noise demystified":
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+///
+/// The array and grid versions evaluate many points per call. With intrinsics
+/// enabled, float 2D and 3D noise runs 4, 8 or 16 points at once, one per SSE2,
+/// AVX or AVX-512 lane. Grids are split across threads in C++11.
 
 #pragma once
 
@@ -26,6 +30,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +60,48 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Classic perlin noise of an array of points: Out[i] = perlin(p[i]) for i in [0, Count).
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void perlin(
+		vec<L, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Simplex noise of an array of points: Out[i] = simplex(p[i]) for i in [0, Count).
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void simplex(
+		vec<L, T, Q> const* p,
+		T* Out,
+		std::size_t Count);
+
+	/// Fill a Width * Height row major grid with classic perlin noise:
+	/// Out[y * Width + x] = perlin(Origin + Step * vec2(x, y)).
+	/// Rows are shared between Threads threads, or one per hardware thread if Threads is 0.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void perlinGrid(
+		vec<2, T, Q> const& Origin,
+		vec<2, T, Q> const& Step,
+		std::size_t Width,
+		std::size_t Height,
+		T* Out,
+		unsigned int Threads = 0);
+
+	/// Fill a Width * Height row major grid with simplex noise:
+	/// Out[y * Width + x] = simplex(Origin + Step * vec2(x, y)).
+	/// Rows are shared between Threads threads, or one per hardware thread if Threads is 0.
+	/// @see gtc_noise
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void simplexGrid(
+		vec<2, T, Q> const& Origin,
+		vec<2, T, Q> const& Step,
+		std::size_t Width,
+		std::size_t Height,
+		T* Out,
+		unsigned int Threads = 0);
+
 	/// @}
 }//namespace glm
 
@@ -5,6 +5,15 @@
 // Following Stefan Gustavson's paper "Simplex noise demystified":
 // http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#endif
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <algorithm>
+#	include <thread>
+#	include <vector>
+#endif
+
 namespace glm{
 namespace gtc
 {
@@ -805,3 +814,550 @@ namespace gtc
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	// Batched noise: the kernels below evaluate one point per lane of a packet,
+	// in the same order of operations as the scalar functions above. The math
+	// of a packet is found through argument dependent lookup, so detail::permute,
+	// mod289 and taylorInvSqrt work on packets as they are.
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet noise_mod289(packet const& x)
+	{
+		return x - packet(289) * floor(x / packet(289));
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet noise_fade(packet const& t)
+	{
+		return (t * t * t) * (t * (t * packet(6) - packet(15)) + packet(10));
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet noise_mix(packet const& x, packet const& y, packet const& a)
+	{
+		return x * (packet(1) - a) + y * a;
+	}
+
+	// Gradient of a perlin 2D corner, dotted with the offset (fx, fy) to the corner
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet perlin_corner(packet const& i, packet const& fx, packet const& fy)
+	{
+		packet gx = packet(2) * fract(i / packet(41)) - packet(1);
+		packet const gy = abs(gx) - packet(0.5);
+		gx = gx - floor(gx + packet(0.5));
+		packet const norm = taylorInvSqrt(gx * gx + gy * gy);
+		return (gx * norm) * fx + (gy * norm) * fy;
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet perlin_corner(packet const& i, packet const& fx, packet const& fy, packet const& fz)
+	{
+		packet gx = i * packet(1.0 / 7.0);
+		packet gy = fract(floor(gx) * packet(1.0 / 7.0)) - packet(0.5);
+		gx = fract(gx);
+		packet const gz = packet(0.5) - abs(gx) - abs(gy);
+		packet const sz = step(gz, packet(0));
+		gx = gx - sz * (step(packet(0), gx) - packet(0.5));
+		gy = gy - sz * (step(packet(0), gy) - packet(0.5));
+		packet const norm = taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * norm) * fx + (gy * norm) * fy + (gz * norm) * fz;
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet perlin_packet(packet const& x, packet const& y)
+	{
+		packet const Pix0 = noise_mod289(floor(x));
+		packet const Piy0 = noise_mod289(floor(y));
+		packet const Pix1 = noise_mod289(floor(x) + packet(1));
+		packet const Piy1 = noise_mod289(floor(y) + packet(1));
+		packet const Pfx0 = fract(x);
+		packet const Pfy0 = fract(y);
+		packet const Pfx1 = Pfx0 - packet(1);
+		packet const Pfy1 = Pfy0 - packet(1);
+
+		packet const n00 = perlin_corner(permute(permute(Pix0) + Piy0), Pfx0, Pfy0);
+		packet const n10 = perlin_corner(permute(permute(Pix1) + Piy0), Pfx1, Pfy0);
+		packet const n01 = perlin_corner(permute(permute(Pix0) + Piy1), Pfx0, Pfy1);
+		packet const n11 = perlin_corner(permute(permute(Pix1) + Piy1), Pfx1, Pfy1);
+
+		packet const n_x0 = noise_mix(n00, n10, noise_fade(Pfx0));
+		packet const n_x1 = noise_mix(n01, n11, noise_fade(Pfx0));
+		return packet(2.3) * noise_mix(n_x0, n_x1, noise_fade(Pfy0));
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet perlin_packet(packet const& x, packet const& y, packet const& z)
+	{
+		packet const Pix0 = mod289(floor(x));
+		packet const Piy0 = mod289(floor(y));
+		packet const Piz0 = mod289(floor(z));
+		packet const Pix1 = mod289(floor(x) + packet(1));
+		packet const Piy1 = mod289(floor(y) + packet(1));
+		packet const Piz1 = mod289(floor(z) + packet(1));
+		packet const Pfx0 = fract(x);
+		packet const Pfy0 = fract(y);
+		packet const Pfz0 = fract(z);
+		packet const Pfx1 = Pfx0 - packet(1);
+		packet const Pfy1 = Pfy0 - packet(1);
+		packet const Pfz1 = Pfz0 - packet(1);
+
+		packet const ixy00 = permute(permute(Pix0) + Piy0);
+		packet const ixy10 = permute(permute(Pix1) + Piy0);
+		packet const ixy01 = permute(permute(Pix0) + Piy1);
+		packet const ixy11 = permute(permute(Pix1) + Piy1);
+
+		packet const n000 = perlin_corner(permute(ixy00 + Piz0), Pfx0, Pfy0, Pfz0);
+		packet const n100 = perlin_corner(permute(ixy10 + Piz0), Pfx1, Pfy0, Pfz0);
+		packet const n010 = perlin_corner(permute(ixy01 + Piz0), Pfx0, Pfy1, Pfz0);
+		packet const n110 = perlin_corner(permute(ixy11 + Piz0), Pfx1, Pfy1, Pfz0);
+		packet const n001 = perlin_corner(permute(ixy00 + Piz1), Pfx0, Pfy0, Pfz1);
+		packet const n101 = perlin_corner(permute(ixy10 + Piz1), Pfx1, Pfy0, Pfz1);
+		packet const n011 = perlin_corner(permute(ixy01 + Piz1), Pfx0, Pfy1, Pfz1);
+		packet const n111 = perlin_corner(permute(ixy11 + Piz1), Pfx1, Pfy1, Pfz1);
+
+		packet const fade_x = noise_fade(Pfx0);
+		packet const fade_y = noise_fade(Pfy0);
+		packet const fade_z = noise_fade(Pfz0);
+		packet const n_z00 = noise_mix(n000, n001, fade_z);
+		packet const n_z10 = noise_mix(n100, n101, fade_z);
+		packet const n_z01 = noise_mix(n010, n011, fade_z);
+		packet const n_z11 = noise_mix(n110, n111, fade_z);
+		packet const n_yz0 = noise_mix(n_z00, n_z01, fade_y);
+		packet const n_yz1 = noise_mix(n_z10, n_z11, fade_y);
+		return packet(2.2) * noise_mix(n_yz0, n_yz1, fade_x);
+	}
+
+	// Contribution of a simplex 2D corner with hash p at offset (x, y)
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet simplex_corner(packet const& p, packet const& x, packet const& y)
+	{
+		packet m = max(packet(0.5) - (x * x + y * y), packet(0));
+		m = m * m;
+		m = m * m;
+
+		packet const gx = packet(2) * fract(p * packet(0.024390243902439)) - packet(1);
+		packet const h = abs(gx) - packet(0.5);
+		packet const a0 = gx - floor(gx + packet(0.5));
+		m = m * (packet(1.79284291400159) - packet(0.85373472095314) * (a0 * a0 + h * h));
+		return m * (a0 * x + h * y);
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet simplex_corner(packet const& p, packet const& x, packet const& y, packet const& z)
+	{
+		typedef typename packet::value_type T;
+		T const n_ = static_cast<T>(0.142857142857); // 1.0/7.0
+		packet const nsx(n_ * T(2) - T(0));
+		packet const nsy(n_ * T(0.5) - T(1));
+		packet const nsz(n_ * T(1) - T(0));
+
+		packet const j = p - packet(49) * floor(p * nsz * nsz);
+		packet const x_ = floor(j * nsz);
+		packet const y_ = floor(j - packet(7) * x_);
+		packet const gx = x_ * nsx + nsy;
+		packet const gy = y_ * nsx + nsy;
+		packet const h = packet(1) - abs(gx) - abs(gy);
+		packet const sh = -step(h, packet(0));
+		packet const ax = gx + (floor(gx) * packet(2) + packet(1)) * sh;
+		packet const ay = gy + (floor(gy) * packet(2) + packet(1)) * sh;
+
+		packet const norm = taylorInvSqrt(ax * ax + ay * ay + h * h);
+		packet m = max(packet(0.6) - (x * x + y * y + z * z), packet(0));
+		m = m * m;
+		return (m * m) * ((ax * norm) * x + (ay * norm) * y + (h * norm) * z);
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet simplex_packet(packet const& vx, packet const& vy)
+	{
+		typedef typename packet::value_type T;
+		T const C0 = T(0.211324865405187);
+		T const C1 = T(0.366025403784439);
+		T const C2 = T(-0.577350269189626);
+
+		// First corner
+		packet const s = vx * packet(C1) + vy * packet(C1);
+		packet ix = floor(vx + s);
+		packet iy = floor(vy + s);
+		packet const t = ix * packet(C0) + iy * packet(C0);
+		packet const x0 = vx - ix + t;
+		packet const y0 = vy - iy + t;
+
+		// Other corners
+		packet const i1x = greater(x0, y0);
+		packet const i1y = packet(1) - i1x;
+		packet const x1 = x0 + packet(C0) - i1x;
+		packet const y1 = y0 + packet(C0) - i1y;
+		packet const x2 = x0 + packet(C2);
+		packet const y2 = y0 + packet(C2);
+
+		// Permutations
+		ix = noise_mod289(ix);
+		iy = noise_mod289(iy);
+		packet const p0 = permute(permute(iy) + ix);
+		packet const p1 = permute(permute(iy + i1y) + ix + i1x);
+		packet const p2 = permute(permute(iy + packet(1)) + ix + packet(1));
+
+		packet const n = simplex_corner(p0, x0, y0) + simplex_corner(p1, x1, y1) + simplex_corner(p2, x2, y2);
+		return packet(130) * n;
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet simplex_packet(packet const& vx, packet const& vy, packet const& vz)
+	{
+		typedef typename packet::value_type T;
+		T const Cx = T(1.0 / 6.0);
+		T const Cy = T(1.0 / 3.0);
+
+		// First corner
+		packet const s = vx * packet(Cy) + vy * packet(Cy) + vz * packet(Cy);
+		packet ix = floor(vx + s);
+		packet iy = floor(vy + s);
+		packet iz = floor(vz + s);
+		packet const t = ix * packet(Cx) + iy * packet(Cx) + iz * packet(Cx);
+		packet const x0 = vx - ix + t;
+		packet const y0 = vy - iy + t;
+		packet const z0 = vz - iz + t;
+
+		// Other corners
+		packet const gx = step(y0, x0);
+		packet const gy = step(z0, y0);
+		packet const gz = step(x0, z0);
+		packet const lx = packet(1) - gx;
+		packet const ly = packet(1) - gy;
+		packet const lz = packet(1) - gz;
+		packet const i1x = min(gx, lz);
+		packet const i1y = min(gy, lx);
+		packet const i1z = min(gz, ly);
+		packet const i2x = max(gx, lz);
+		packet const i2y = max(gy, lx);
+		packet const i2z = max(gz, ly);
+
+		packet const x1 = x0 - i1x + packet(Cx);
+		packet const y1 = y0 - i1y + packet(Cx);
+		packet const z1 = z0 - i1z + packet(Cx);
+		packet const x2 = x0 - i2x + packet(Cy);
+		packet const y2 = y0 - i2y + packet(Cy);
+		packet const z2 = z0 - i2z + packet(Cy);
+		packet const x3 = x0 - packet(0.5);
+		packet const y3 = y0 - packet(0.5);
+		packet const z3 = z0 - packet(0.5);
+
+		// Permutations
+		ix = mod289(ix);
+		iy = mod289(iy);
+		iz = mod289(iz);
+		packet const p0 = permute(permute(permute(iz) + iy) + ix);
+		packet const p1 = permute(permute(permute(iz + i1z) + iy + i1y) + ix + i1x);
+		packet const p2 = permute(permute(permute(iz + i2z) + iy + i2y) + ix + i2x);
+		packet const p3 = permute(permute(permute(iz + packet(1)) + iy + packet(1)) + ix + packet(1));
+
+		packet const n =
+			simplex_corner(p0, x0, y0, z0) + simplex_corner(p1, x1, y1, z1) +
+			simplex_corner(p2, x2, y2, z2) + simplex_corner(p3, x3, y3, z3);
+		return packet(42) * n;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	struct noise_vec16
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 16;
+
+		noise_vec16() {}
+		explicit noise_vec16(__m512 v) : data(v) {}
+		explicit noise_vec16(float s) : data(_mm512_set1_ps(s)) {}
+
+		static noise_vec16 load(float const* p) { return noise_vec16(_mm512_loadu_ps(p)); }
+		static noise_vec16 iota() { return noise_vec16(_mm512_set_ps(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)); }
+		void store(float* p) const { _mm512_storeu_ps(p, data); }
+
+		friend noise_vec16 operator+(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_add_ps(a.data, b.data)); }
+		friend noise_vec16 operator-(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_sub_ps(a.data, b.data)); }
+		friend noise_vec16 operator*(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_mul_ps(a.data, b.data)); }
+		friend noise_vec16 operator/(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_div_ps(a.data, b.data)); }
+		friend noise_vec16 operator-(noise_vec16 a) { return noise_vec16(_mm512_sub_ps(_mm512_setzero_ps(), a.data)); }
+		friend noise_vec16 floor(noise_vec16 a) { return noise_vec16(_mm512_roundscale_ps(a.data, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)); }
+		friend noise_vec16 fract(noise_vec16 a) { return a - floor(a); }
+		friend noise_vec16 abs(noise_vec16 a) { return noise_vec16(_mm512_abs_ps(a.data)); }
+		friend noise_vec16 min(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_min_ps(a.data, b.data)); }
+		friend noise_vec16 max(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_max_ps(a.data, b.data)); }
+		friend noise_vec16 step(noise_vec16 edge, noise_vec16 x) { return noise_vec16(_mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x.data, edge.data, _CMP_GE_OQ), _mm512_set1_ps(1.0f))); }
+		friend noise_vec16 greater(noise_vec16 a, noise_vec16 b) { return noise_vec16(_mm512_maskz_mov_ps(_mm512_cmp_ps_mask(a.data, b.data, _CMP_GT_OQ), _mm512_set1_ps(1.0f))); }
+
+		__m512 data;
+	};
+
+	typedef noise_vec16 noise_packet;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct noise_vec8
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 8;
+
+		noise_vec8() {}
+		explicit noise_vec8(__m256 v) : data(v) {}
+		explicit noise_vec8(float s) : data(_mm256_set1_ps(s)) {}
+
+		static noise_vec8 load(float const* p) { return noise_vec8(_mm256_loadu_ps(p)); }
+		static noise_vec8 iota() { return noise_vec8(_mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0)); }
+		void store(float* p) const { _mm256_storeu_ps(p, data); }
+
+		friend noise_vec8 operator+(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_add_ps(a.data, b.data)); }
+		friend noise_vec8 operator-(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_sub_ps(a.data, b.data)); }
+		friend noise_vec8 operator*(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_mul_ps(a.data, b.data)); }
+		friend noise_vec8 operator/(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_div_ps(a.data, b.data)); }
+		friend noise_vec8 operator-(noise_vec8 a) { return noise_vec8(_mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f))); }
+		friend noise_vec8 floor(noise_vec8 a) { return noise_vec8(_mm256_floor_ps(a.data)); }
+		friend noise_vec8 fract(noise_vec8 a) { return a - floor(a); }
+		friend noise_vec8 abs(noise_vec8 a) { return noise_vec8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.data)); }
+		friend noise_vec8 min(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_min_ps(a.data, b.data)); }
+		friend noise_vec8 max(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_max_ps(a.data, b.data)); }
+		friend noise_vec8 step(noise_vec8 edge, noise_vec8 x) { return noise_vec8(_mm256_and_ps(_mm256_cmp_ps(x.data, edge.data, _CMP_GE_OQ), _mm256_set1_ps(1.0f))); }
+		friend noise_vec8 greater(noise_vec8 a, noise_vec8 b) { return noise_vec8(_mm256_and_ps(_mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ), _mm256_set1_ps(1.0f))); }
+
+		__m256 data;
+	};
+
+	typedef noise_vec8 noise_packet;
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct noise_vec4
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 4;
+
+		noise_vec4() {}
+		explicit noise_vec4(__m128 v) : data(v) {}
+		explicit noise_vec4(float s) : data(_mm_set1_ps(s)) {}
+
+		static noise_vec4 load(float const* p) { return noise_vec4(_mm_loadu_ps(p)); }
+		static noise_vec4 iota() { return noise_vec4(_mm_set_ps(3, 2, 1, 0)); }
+		void store(float* p) const { _mm_storeu_ps(p, data); }
+
+		friend noise_vec4 operator+(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_add_ps(a.data, b.data)); }
+		friend noise_vec4 operator-(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_sub_ps(a.data, b.data)); }
+		friend noise_vec4 operator*(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_mul_ps(a.data, b.data)); }
+		friend noise_vec4 operator/(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_div_ps(a.data, b.data)); }
+		friend noise_vec4 operator-(noise_vec4 a) { return noise_vec4(_mm_xor_ps(a.data, _mm_set1_ps(-0.0f))); }
+		friend noise_vec4 floor(noise_vec4 a) { return noise_vec4(glm_vec4_floor(a.data)); }
+		friend noise_vec4 fract(noise_vec4 a) { return a - floor(a); }
+		friend noise_vec4 abs(noise_vec4 a) { return noise_vec4(glm_vec4_abs(a.data)); }
+		friend noise_vec4 min(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_min_ps(a.data, b.data)); }
+		friend noise_vec4 max(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_max_ps(a.data, b.data)); }
+		friend noise_vec4 step(noise_vec4 edge, noise_vec4 x) { return noise_vec4(_mm_and_ps(_mm_cmpge_ps(x.data, edge.data), _mm_set1_ps(1.0f))); }
+		friend noise_vec4 greater(noise_vec4 a, noise_vec4 b) { return noise_vec4(_mm_and_ps(_mm_cmpgt_ps(a.data, b.data), _mm_set1_ps(1.0f))); }
+
+		__m128 data;
+	};
+
+	typedef noise_vec4 noise_packet;
+#	endif
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_noise_batch
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<L, T, Q> const* p, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::perlin(p[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<L, T, Q> const* p, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::simplex(p[i]);
+		}
+	};
+
+	// A row of a 2D grid: Out[i] = noise(x + dx * i, y) for i in [0, Count)
+	template<typename T, qualifier Q>
+	struct compute_noise_row
+	{
+		GLM_FUNC_QUALIFIER static void perlin(T x, T dx, T y, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::perlin(vec<2, T, Q>(x + dx * static_cast<T>(i), y));
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(T x, T dx, T y, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::simplex(vec<2, T, Q>(x + dx * static_cast<T>(i), y));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Transposes up to a packet of points into one packet per component. Lanes
+	// past Count repeat the last point and are not stored back.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_load(vec<L, float, Q> const* p, std::size_t Count, noise_packet* Lanes)
+	{
+		float Tmp[L][noise_packet::lanes];
+		for(std::size_t i = 0; i < noise_packet::lanes; ++i)
+			for(length_t c = 0; c < L; ++c)
+				Tmp[c][i] = p[i < Count ? i : Count - 1][c];
+		for(length_t c = 0; c < L; ++c)
+			Lanes[c] = noise_packet::load(Tmp[c]);
+	}
+
+	GLM_FUNC_QUALIFIER void noise_store(noise_packet const& v, float* Out, std::size_t Count)
+	{
+		if(Count >= noise_packet::lanes)
+			return v.store(Out);
+
+		float Tmp[noise_packet::lanes];
+		v.store(Tmp);
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = Tmp[i];
+	}
+
+	template<qualifier Q>
+	struct compute_noise_batch<2, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<2, float, Q> const* p, float* Out, std::size_t Count)
+		{
+			noise_packet v[2];
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_load(p + i, Count - i, v);
+				noise_store(perlin_packet(v[0], v[1]), Out + i, Count - i);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<2, float, Q> const* p, float* Out, std::size_t Count)
+		{
+			noise_packet v[2];
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_load(p + i, Count - i, v);
+				noise_store(simplex_packet(v[0], v[1]), Out + i, Count - i);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_noise_batch<3, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(vec<3, float, Q> const* p, float* Out, std::size_t Count)
+		{
+			noise_packet v[3];
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_load(p + i, Count - i, v);
+				noise_store(perlin_packet(v[0], v[1], v[2]), Out + i, Count - i);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(vec<3, float, Q> const* p, float* Out, std::size_t Count)
+		{
+			noise_packet v[3];
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_load(p + i, Count - i, v);
+				noise_store(simplex_packet(v[0], v[1], v[2]), Out + i, Count - i);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_noise_row<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void perlin(float x, float dx, float y, float* Out, std::size_t Count)
+		{
+			noise_packet const Y(y);
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_packet const X = noise_packet(x) + noise_packet(dx) * (noise_packet(static_cast<float>(i)) + noise_packet::iota());
+				noise_store(perlin_packet(X, Y), Out + i, Count - i);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void simplex(float x, float dx, float y, float* Out, std::size_t Count)
+		{
+			noise_packet const Y(y);
+			for(std::size_t i = 0; i < Count; i += noise_packet::lanes)
+			{
+				noise_packet const X = noise_packet(x) + noise_packet(dx) * (noise_packet(static_cast<float>(i)) + noise_packet::iota());
+				noise_store(simplex_packet(X, Y), Out + i, Count - i);
+			}
+		}
+	};
+#	endif
+
+	template<typename T>
+	struct noise_grid
+	{
+		typedef void (*row_func)(T x, T dx, T y, T* Out, std::size_t Count);
+
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			// Joins the started workers however call() is left: if starting a thread
+			// throws, destroying the joinable ones would call std::terminate
+			struct workers
+			{
+				std::vector<std::thread> Threads;
+
+				~workers()
+				{
+					for(std::size_t t = 0; t < Threads.size(); ++t)
+						Threads[t].join();
+				}
+			};
+#		endif
+
+		GLM_FUNC_QUALIFIER static void rows(row_func Row, T x, T dx, T y, T dy, std::size_t Width, std::size_t Begin, std::size_t End, T* Out)
+		{
+			for(std::size_t j = Begin; j < End; ++j)
+				Row(x, dx, y + dy * static_cast<T>(j), Out + j * Width, Width);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(row_func Row, T x, T dx, T y, T dy, std::size_t Width, std::size_t Height, T* Out, unsigned int Threads)
+		{
+#			if GLM_LANG & GLM_LANG_CXX11_FLAG
+				if(Threads == 0)
+					Threads = std::max(std::thread::hardware_concurrency(), 1u);
+				std::size_t const Count = std::min<std::size_t>(Threads, Height);
+				if(Count > 1)
+				{
+					// Contiguous bands of rows, the calling thread takes the last one
+					workers Workers;
+					Workers.Threads.reserve(Count - 1);
+					for(std::size_t t = 0; t + 1 < Count; ++t)
+						Workers.Threads.push_back(std::thread(&noise_grid::rows, Row, x, dx, y, dy, Width, Height * t / Count, Height * (t + 1) / Count, Out));
+					rows(Row, x, dx, y, dy, Width, Height * (Count - 1) / Count, Height, Out);
+					return;
+				}
+#			else
+				static_cast<void>(Threads);
+#			endif
+			rows(Row, x, dx, y, dy, Width, 0, Height, Out);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::compute_noise_batch<L, T, Q>::perlin(p, Out, Count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, T, Q> const* p, T* Out, std::size_t Count)
+	{
+		detail::compute_noise_batch<L, T, Q>::simplex(p, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t Height, T* Out, unsigned int Threads)
+	{
+		detail::noise_grid<T>::call(&detail::compute_noise_row<T, Q>::perlin, Origin.x, Step.x, Origin.y, Step.y, Width, Height, Out, Threads);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<2, T, Q> const& Origin, vec<2, T, Q> const& Step, std::size_t Width, std::size_t Height, T* Out, unsigned int Threads)
+	{
+		detail::noise_grid<T>::call(&detail::compute_noise_row<T, Q>::simplex, Origin.x, Step.x, Origin.y, Step.y, Width, Height, Out, Threads);
+	}
+}//namespace glm
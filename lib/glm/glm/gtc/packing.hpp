@@ -16,6 +16,7 @@
 // Dependency:
 #include "type_precision.hpp"
 #include "../ext/vector_packing.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -540,6 +541,50 @@ namespace glm
 	template<typename floatType, length_t L, typename intType, qualifier Q>
 	GLM_FUNC_DECL vec<L, floatType, Q> unpackSnorm(vec<L, intType, Q> const& v);
 
+	/// Convert Count floats to 16-bit floating-point numbers: Out[i] is the half of v[i], rounded to nearest even.
+	/// With intrinsics enabled this uses SSE2, F16C or AVX-512.
+	/// Ties may round differently from packHalf1x16, which rounds them up.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalf(uint16 const* p, float* Out, std::size_t Count)
+	GLM_FUNC_DECL void packHalf(float const* v, uint16* Out, std::size_t Count);
+
+	/// Convert Count 16-bit floating-point numbers to floats: Out[i] = unpackHalf1x16(p[i]).
+	///
+	/// @see gtc_packing
+	/// @see void packHalf(float const* v, uint16* Out, std::size_t Count)
+	GLM_FUNC_DECL void unpackHalf(uint16 const* p, float* Out, std::size_t Count);
+
+	/// Convert Count normalized floats to unsigned integers: Out[i] = round(clamp(v[i], 0, 1) * max(uintType)).
+	/// With intrinsics enabled, float to uint8 and uint16 use SSE2.
+	///
+	/// @see gtc_packing
+	/// @see void unpackUnorm(uintType const* p, floatType* Out, std::size_t Count)
+	template<typename uintType, typename floatType>
+	GLM_FUNC_DECL void packUnorm(floatType const* v, uintType* Out, std::size_t Count);
+
+	/// Convert Count unsigned integers to normalized floats: Out[i] = p[i] / max(uintType).
+	///
+	/// @see gtc_packing
+	/// @see void packUnorm(floatType const* v, uintType* Out, std::size_t Count)
+	template<typename floatType, typename uintType>
+	GLM_FUNC_DECL void unpackUnorm(uintType const* p, floatType* Out, std::size_t Count);
+
+	/// Convert Count normalized floats to signed integers: Out[i] = round(clamp(v[i], -1, 1) * max(intType)).
+	/// With intrinsics enabled, float to int8 and int16 use SSE2.
+	///
+	/// @see gtc_packing
+	/// @see void unpackSnorm(intType const* p, floatType* Out, std::size_t Count)
+	template<typename intType, typename floatType>
+	GLM_FUNC_DECL void packSnorm(floatType const* v, intType* Out, std::size_t Count);
+
+	/// Convert Count signed integers to normalized floats: Out[i] = clamp(p[i] / max(intType), -1, 1).
+	///
+	/// @see gtc_packing
+	/// @see void packSnorm(floatType const* v, intType* Out, std::size_t Count)
+	template<typename floatType, typename intType>
+	GLM_FUNC_DECL void unpackSnorm(intType const* p, floatType* Out, std::size_t Count);
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
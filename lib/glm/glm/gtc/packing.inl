@@ -10,6 +10,10 @@
 #include <cstring>
 #include <limits>
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/packing.h"
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -350,6 +354,156 @@ namespace detail
 			return vec<4, float, Q>(detail::toFloat32(v.x), detail::toFloat32(v.y), detail::toFloat32(v.z), detail::toFloat32(v.w));
 		}
 	};
+
+	// IEEE conversion with round to nearest even, like F16C, where toFloat16
+	// rounds ties up. NaNs become the quiet NaN 0x7e00.
+	GLM_FUNC_QUALIFIER uint16 toFloat16RoundEven(float f)
+	{
+		uint32 Bits = 0;
+		memcpy(&Bits, &f, sizeof(Bits));
+		uint32 const Sign = Bits & 0x80000000u;
+		Bits ^= Sign;
+
+		uint32 Half = 0;
+		if(Bits >= ((127u + 16u) << 23)) // overflow, infinity or NaN
+			Half = Bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+		else if(Bits < ((127u - 14u) << 23)) // subnormal half: the float add rounds the mantissa
+		{
+			uint32 const Magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+			float Abs = 0, MagicFloat = 0;
+			memcpy(&Abs, &Bits, sizeof(Abs));
+			memcpy(&MagicFloat, &Magic, sizeof(MagicFloat));
+			Abs += MagicFloat;
+			memcpy(&Half, &Abs, sizeof(Half));
+			Half -= Magic;
+		}
+		else // rebias the exponent, add half an ulp minus one, plus one if the result is odd
+			Half = (Bits + (0xfffu - ((127u - 15u) << 23)) + ((Bits >> 13) & 1u)) >> 13;
+
+		return static_cast<uint16>(Half | (Sign >> 16));
+	}
+
+	template<typename T>
+	struct compute_half_batch
+	{
+		GLM_FUNC_QUALIFIER static void pack(T const* v, uint16* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = toFloat16RoundEven(static_cast<float>(v[i]));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* p, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<T>(toFloat32(p[i]));
+		}
+	};
+
+	template<typename floatType, typename uintType>
+	struct compute_unorm_batch
+	{
+		GLM_FUNC_QUALIFIER static void pack(floatType const* v, uintType* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<uintType>(round(clamp(v[i], static_cast<floatType>(0), static_cast<floatType>(1)) * static_cast<floatType>(std::numeric_limits<uintType>::max())));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uintType const* p, floatType* Out, std::size_t Count)
+		{
+			floatType const Scale = static_cast<floatType>(1) / static_cast<floatType>(std::numeric_limits<uintType>::max());
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<floatType>(p[i]) * Scale;
+		}
+	};
+
+	template<typename floatType, typename intType>
+	struct compute_snorm_batch
+	{
+		GLM_FUNC_QUALIFIER static void pack(floatType const* v, intType* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = static_cast<intType>(round(clamp(v[i], static_cast<floatType>(-1), static_cast<floatType>(1)) * static_cast<floatType>(std::numeric_limits<intType>::max())));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(intType const* p, floatType* Out, std::size_t Count)
+		{
+			floatType const Scale = static_cast<floatType>(1) / static_cast<floatType>(std::numeric_limits<intType>::max());
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = clamp(static_cast<floatType>(p[i]) * Scale, static_cast<floatType>(-1), static_cast<floatType>(1));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_half_batch<float>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* v, uint16* Out, std::size_t Count)
+		{
+			glm_half_pack_batch(v, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* p, float* Out, std::size_t Count)
+		{
+			glm_half_unpack_batch(p, Out, Count);
+		}
+	};
+
+	template<>
+	struct compute_unorm_batch<float, uint8>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* v, uint8* Out, std::size_t Count)
+		{
+			glm_packing_batch<16>(v, Out, Count, glm_unorm8_pack_block);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint8 const* p, float* Out, std::size_t Count)
+		{
+			glm_packing_batch<16>(p, Out, Count, glm_unorm8_unpack_block);
+		}
+	};
+
+	template<>
+	struct compute_unorm_batch<float, uint16>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* v, uint16* Out, std::size_t Count)
+		{
+			glm_packing_batch<8>(v, Out, Count, glm_unorm16_pack_block);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* p, float* Out, std::size_t Count)
+		{
+			glm_packing_batch<8>(p, Out, Count, glm_unorm16_unpack_block);
+		}
+	};
+
+	template<>
+	struct compute_snorm_batch<float, int8>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* v, int8* Out, std::size_t Count)
+		{
+			glm_packing_batch<16>(v, Out, Count, glm_snorm8_pack_block);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(int8 const* p, float* Out, std::size_t Count)
+		{
+			glm_packing_batch<16>(p, Out, Count, glm_snorm8_unpack_block);
+		}
+	};
+
+	template<>
+	struct compute_snorm_batch<float, int16>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* v, int16* Out, std::size_t Count)
+		{
+			glm_packing_batch<8>(v, Out, Count, glm_snorm16_pack_block);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(int16 const* p, float* Out, std::size_t Count)
+		{
+			glm_packing_batch<8>(p, Out, Count, glm_snorm16_unpack_block);
+		}
+	};
+#	endif
 }//namespace detail
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
@@ -704,6 +858,52 @@ namespace detail
 		return clamp(vec<L, floatType, Q>(v) * (static_cast<floatType>(1) / static_cast<floatType>(std::numeric_limits<intType>::max())), static_cast<floatType>(-1), static_cast<floatType>(1));
 	}
 
+	GLM_FUNC_QUALIFIER void packHalf(float const* v, uint16* Out, std::size_t Count)
+	{
+		detail::compute_half_batch<float>::pack(v, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* p, float* Out, std::size_t Count)
+	{
+		detail::compute_half_batch<float>::unpack(p, Out, Count);
+	}
+
+	template<typename uintType, typename floatType>
+	GLM_FUNC_QUALIFIER void packUnorm(floatType const* v, uintType* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<uintType>::is_integer, "uintType must be an integer type");
+		GLM_STATIC_ASSERT(std::numeric_limits<floatType>::is_iec559, "floatType must be a floating point type");
+
+		detail::compute_unorm_batch<floatType, uintType>::pack(v, Out, Count);
+	}
+
+	template<typename floatType, typename uintType>
+	GLM_FUNC_QUALIFIER void unpackUnorm(uintType const* p, floatType* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<uintType>::is_integer, "uintType must be an integer type");
+		GLM_STATIC_ASSERT(std::numeric_limits<floatType>::is_iec559, "floatType must be a floating point type");
+
+		detail::compute_unorm_batch<floatType, uintType>::unpack(p, Out, Count);
+	}
+
+	template<typename intType, typename floatType>
+	GLM_FUNC_QUALIFIER void packSnorm(floatType const* v, intType* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<intType>::is_integer, "intType must be an integer type");
+		GLM_STATIC_ASSERT(std::numeric_limits<floatType>::is_iec559, "floatType must be a floating point type");
+
+		detail::compute_snorm_batch<floatType, intType>::pack(v, Out, Count);
+	}
+
+	template<typename floatType, typename intType>
+	GLM_FUNC_QUALIFIER void unpackSnorm(intType const* p, floatType* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<intType>::is_integer, "intType must be an integer type");
+		GLM_STATIC_ASSERT(std::numeric_limits<floatType>::is_iec559, "floatType must be a floating point type");
+
+		detail::compute_snorm_batch<floatType, intType>::unpack(p, Out, Count);
+	}
+
 	GLM_FUNC_QUALIFIER uint8 packUnorm2x4(vec2 const& v)
 	{
 		u32vec2 const Unpack(round(clamp(v, 0.0f, 1.0f) * 15.0f));
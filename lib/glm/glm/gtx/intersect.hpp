@@ -15,7 +15,9 @@
 
 // Dependency:
 #include <cfloat>
+#include <cstddef>
 #include <limits>
+#include <vector>
 #include "../glm.hpp"
 #include "../geometric.hpp"
 #include "../gtx/closest_point.hpp"
@@ -86,6 +88,69 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersections of Count rays and a triangle:
+	//! Hit[i] = intersectRayTriangle(orig[i], dir[i], v0, v1, v2, baryPosition[i], distance[i]).
+	//! baryPosition[i] and distance[i] are only meaningful where Hit[i] is true.
+	//! With intrinsics enabled, float rays are tested 4, 8 or 16 at a time with SSE2, AVX or AVX-512.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void intersectRayTriangle(
+		vec<3, T, Q> const* orig, vec<3, T, Q> const* dir, std::size_t Count,
+		vec<3, T, Q> const& v0, vec<3, T, Q> const& v1, vec<3, T, Q> const& v2,
+		bool* Hit, vec<2, T, Q>* baryPosition, T* distance);
+
+	//! Compute the nearest intersection in front of a ray among Count triangles, each
+	//! given by three consecutive vertices. Returns false if no triangle is hit at a
+	//! distance of 0 or more, otherwise sets the triangle index, and baryPosition and
+	//! distance like intersectRayTriangle. Float triangles are tested a packet at a time.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const* vertices, std::size_t Count,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index);
+
+	//! Bounding volume hierarchy of a triangle soup, built by buildTriangleBVH.
+	//! Nodes[0] is the root. An inner node has Count == 0 and its children at
+	//! First and First + 1, a leaf has the Count triangles from First on.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q = defaultp>
+	struct triangle_bvh
+	{
+		struct node
+		{
+			vec<3, T, Q> Min;
+			vec<3, T, Q> Max;
+			std::size_t First;
+			std::size_t Count;
+		};
+
+		// Triangles past the last one, so that a packet can load a whole leaf
+		static std::size_t const padding = 16;
+
+		std::vector<node> Nodes;
+		std::vector<T> Triangles[9]; // v0.x, v0.y, v0.z, v1.x ... v2.z of each triangle, in leaf order
+		std::vector<std::size_t> Indices; // original index of each triangle
+	};
+
+	//! Build a bounding volume hierarchy of Count triangles, each given by three
+	//! consecutive vertices, splitting nodes with a binned surface area heuristic.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildTriangleBVH(
+		vec<3, T, Q> const* vertices, std::size_t Count,
+		triangle_bvh<T, Q>& BVH);
+
+	//! Compute the nearest intersection in front of a ray among the triangles of a
+	//! bounding volume hierarchy, like intersectRayTriangles. index is the index of
+	//! the triangle in the array given to buildTriangleBVH.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		triangle_bvh<T, Q> const& BVH,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index);
+
 	/// @}
 }//namespace glm
 
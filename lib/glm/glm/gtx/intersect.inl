@@ -1,5 +1,7 @@
 /// @ref gtx_intersect
 
+#include <algorithm>
+
 namespace glm
 {
 	template<typename genType>
@@ -198,3 +200,652 @@ namespace glm
 		return true;
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	// Packet kernels: the ray triangle test below runs one ray and triangle pair
+	// per lane, with either the rays or the triangles the same in every lane.
+	template<typename packet>
+	GLM_FUNC_QUALIFIER void intersect_cross(packet const x[3], packet const y[3], packet Out[3])
+	{
+		Out[0] = x[1] * y[2] - y[1] * x[2];
+		Out[1] = x[2] * y[0] - y[2] * x[0];
+		Out[2] = x[0] * y[1] - y[0] * x[1];
+	}
+
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet intersect_dot(packet const x[3], packet const y[3])
+	{
+		return x[0] * y[0] + x[1] * y[1] + x[2] * y[2];
+	}
+
+	// intersectRayTriangle per lane; returns the mask of the lanes that hit
+	template<typename packet>
+	GLM_FUNC_QUALIFIER packet intersect_ray_triangle_packet(
+		packet const orig[3], packet const dir[3],
+		packet const vert0[3], packet const vert1[3], packet const vert2[3],
+		packet& BaryU, packet& BaryV, packet& Distance)
+	{
+		typedef typename packet::value_type T;
+
+		packet const Edge1[3] = {vert1[0] - vert0[0], vert1[1] - vert0[1], vert1[2] - vert0[2]};
+		packet const Edge2[3] = {vert2[0] - vert0[0], vert2[1] - vert0[1], vert2[2] - vert0[2]};
+		packet const Dist[3] = {orig[0] - vert0[0], orig[1] - vert0[1], orig[2] - vert0[2]};
+
+		packet P[3], Perpendicular[3];
+		intersect_cross(dir, Edge2, P);
+		intersect_cross(Dist, Edge1, Perpendicular);
+		packet const Det = intersect_dot(Edge1, P);
+		packet const U = intersect_dot(Dist, P);
+		packet const V = intersect_dot(dir, Perpendicular);
+
+		// both signs of det as one test on |det|, the bounds mirrored as in intersectRayTriangle
+		packet const Sign = Det & packet(static_cast<T>(-0.0));
+		packet const AbsDet = Det ^ Sign;
+		packet const SignedU = U ^ Sign;
+		packet const SignedV = V ^ Sign;
+		packet const Zero(static_cast<T>(0));
+		packet const Hit =
+			greaterThan(AbsDet, packet(std::numeric_limits<T>::epsilon())) &
+			greaterThanEqual(SignedU, Zero) & lessThanEqual(SignedU, AbsDet) &
+			greaterThanEqual(SignedV, Zero) & lessThanEqual(SignedU + SignedV, AbsDet);
+
+		packet const InvDet = packet(static_cast<T>(1)) / Det;
+		Distance = intersect_dot(Edge2, Perpendicular) * InvDet;
+		BaryU = U * InvDet;
+		BaryV = V * InvDet;
+		return Hit;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	struct intersect_vec16
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 16;
+
+		intersect_vec16() {}
+		explicit intersect_vec16(__m512 v) : data(v) {}
+		explicit intersect_vec16(float s) : data(_mm512_set1_ps(s)) {}
+
+		static intersect_vec16 load(float const* p) { return intersect_vec16(_mm512_loadu_ps(p)); }
+		static intersect_vec16 gather(float const* p, int Stride, int Last)
+		{
+			__m512i const Index = _mm512_min_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(Last));
+			return intersect_vec16(_mm512_i32gather_ps(_mm512_mullo_epi32(Index, _mm512_set1_epi32(Stride)), p, 4));
+		}
+		void store(float* p) const { _mm512_storeu_ps(p, data); }
+		int mask() const { return _mm512_test_epi32_mask(_mm512_castps_si512(data), _mm512_castps_si512(data)); }
+
+		friend intersect_vec16 operator+(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_add_ps(a.data, b.data)); }
+		friend intersect_vec16 operator-(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_sub_ps(a.data, b.data)); }
+		friend intersect_vec16 operator*(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_mul_ps(a.data, b.data)); }
+		friend intersect_vec16 operator/(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_div_ps(a.data, b.data)); }
+		friend intersect_vec16 operator&(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(a.data), _mm512_castps_si512(b.data)))); }
+		friend intersect_vec16 operator^(intersect_vec16 a, intersect_vec16 b) { return intersect_vec16(_mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(a.data), _mm512_castps_si512(b.data)))); }
+		friend intersect_vec16 greaterThan(intersect_vec16 a, intersect_vec16 b) { return select(_mm512_cmp_ps_mask(a.data, b.data, _CMP_GT_OQ)); }
+		friend intersect_vec16 greaterThanEqual(intersect_vec16 a, intersect_vec16 b) { return select(_mm512_cmp_ps_mask(a.data, b.data, _CMP_GE_OQ)); }
+		friend intersect_vec16 lessThan(intersect_vec16 a, intersect_vec16 b) { return select(_mm512_cmp_ps_mask(a.data, b.data, _CMP_LT_OQ)); }
+		friend intersect_vec16 lessThanEqual(intersect_vec16 a, intersect_vec16 b) { return select(_mm512_cmp_ps_mask(a.data, b.data, _CMP_LE_OQ)); }
+
+		static intersect_vec16 select(__mmask16 m) { return intersect_vec16(_mm512_castsi512_ps(_mm512_maskz_set1_epi32(m, -1))); }
+
+		__m512 data;
+	};
+
+	typedef intersect_vec16 intersect_packet;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct intersect_vec8
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 8;
+
+		intersect_vec8() {}
+		explicit intersect_vec8(__m256 v) : data(v) {}
+		explicit intersect_vec8(float s) : data(_mm256_set1_ps(s)) {}
+
+		static intersect_vec8 load(float const* p) { return intersect_vec8(_mm256_loadu_ps(p)); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		static intersect_vec8 gather(float const* p, int Stride, int Last)
+		{
+			__m256i const Index = _mm256_min_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(Last));
+			return intersect_vec8(_mm256_i32gather_ps(p, _mm256_mullo_epi32(Index, _mm256_set1_epi32(Stride)), 4));
+		}
+#		else
+		static intersect_vec8 gather(float const* p, int Stride, int Last)
+		{
+			return intersect_vec8(_mm256_setr_ps(
+				p[0], p[min(1, Last) * Stride], p[min(2, Last) * Stride], p[min(3, Last) * Stride],
+				p[min(4, Last) * Stride], p[min(5, Last) * Stride], p[min(6, Last) * Stride], p[min(7, Last) * Stride]));
+		}
+#		endif
+		void store(float* p) const { _mm256_storeu_ps(p, data); }
+		int mask() const { return _mm256_movemask_ps(data); }
+
+		friend intersect_vec8 operator+(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_add_ps(a.data, b.data)); }
+		friend intersect_vec8 operator-(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_sub_ps(a.data, b.data)); }
+		friend intersect_vec8 operator*(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_mul_ps(a.data, b.data)); }
+		friend intersect_vec8 operator/(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_div_ps(a.data, b.data)); }
+		friend intersect_vec8 operator&(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_and_ps(a.data, b.data)); }
+		friend intersect_vec8 operator^(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_xor_ps(a.data, b.data)); }
+		friend intersect_vec8 greaterThan(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ)); }
+		friend intersect_vec8 greaterThanEqual(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_cmp_ps(a.data, b.data, _CMP_GE_OQ)); }
+		friend intersect_vec8 lessThan(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ)); }
+		friend intersect_vec8 lessThanEqual(intersect_vec8 a, intersect_vec8 b) { return intersect_vec8(_mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ)); }
+
+		__m256 data;
+	};
+
+	typedef intersect_vec8 intersect_packet;
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct intersect_vec4
+	{
+		typedef float value_type;
+		static std::size_t const lanes = 4;
+
+		intersect_vec4() {}
+		explicit intersect_vec4(__m128 v) : data(v) {}
+		explicit intersect_vec4(float s) : data(_mm_set1_ps(s)) {}
+
+		static intersect_vec4 load(float const* p) { return intersect_vec4(_mm_loadu_ps(p)); }
+		static intersect_vec4 gather(float const* p, int Stride, int Last)
+		{
+			return intersect_vec4(_mm_setr_ps(p[0], p[min(1, Last) * Stride], p[min(2, Last) * Stride], p[min(3, Last) * Stride]));
+		}
+		void store(float* p) const { _mm_storeu_ps(p, data); }
+		int mask() const { return _mm_movemask_ps(data); }
+
+		friend intersect_vec4 operator+(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_add_ps(a.data, b.data)); }
+		friend intersect_vec4 operator-(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_sub_ps(a.data, b.data)); }
+		friend intersect_vec4 operator*(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_mul_ps(a.data, b.data)); }
+		friend intersect_vec4 operator/(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_div_ps(a.data, b.data)); }
+		friend intersect_vec4 operator&(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_and_ps(a.data, b.data)); }
+		friend intersect_vec4 operator^(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_xor_ps(a.data, b.data)); }
+		friend intersect_vec4 greaterThan(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_cmpgt_ps(a.data, b.data)); }
+		friend intersect_vec4 greaterThanEqual(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_cmpge_ps(a.data, b.data)); }
+		friend intersect_vec4 lessThan(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_cmplt_ps(a.data, b.data)); }
+		friend intersect_vec4 lessThanEqual(intersect_vec4 a, intersect_vec4 b) { return intersect_vec4(_mm_cmple_ps(a.data, b.data)); }
+
+		__m128 data;
+	};
+
+	typedef intersect_vec4 intersect_packet;
+#	endif
+
+	// Keeps the hit of v0, v1, v2 if it is in [0, distance)
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersect_nearest(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& v0, vec<3, T, Q> const& v1, vec<3, T, Q> const& v2, std::size_t Index,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index)
+	{
+		vec<2, T, Q> Bary(0);
+		T Distance(0);
+		if(!intersectRayTriangle(orig, dir, v0, v1, v2, Bary, Distance) || Distance < static_cast<T>(0) || Distance >= distance)
+			return false;
+		baryPosition = Bary;
+		distance = Distance;
+		index = Index;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	struct compute_intersect_batch
+	{
+		GLM_FUNC_QUALIFIER static void rays(
+			vec<3, T, Q> const* orig, vec<3, T, Q> const* dir, std::size_t Count,
+			vec<3, T, Q> const& v0, vec<3, T, Q> const& v1, vec<3, T, Q> const& v2,
+			bool* Hit, vec<2, T, Q>* baryPosition, T* distance)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Hit[i] = intersectRayTriangle(orig[i], dir[i], v0, v1, v2, baryPosition[i], distance[i]);
+		}
+
+		// Nearest hit at a distance in [0, distance), which is left alone if there is none
+		GLM_FUNC_QUALIFIER static bool nearest(
+			vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+			vec<3, T, Q> const* vertices, std::size_t Count,
+			vec<2, T, Q>& baryPosition, T& distance, std::size_t& index)
+		{
+			bool Result = false;
+			for(std::size_t i = 0; i < Count; ++i)
+				Result = intersect_nearest(orig, dir, vertices[i * 3 + 0], vertices[i * 3 + 1], vertices[i * 3 + 2], i, baryPosition, distance, index) || Result;
+			return Result;
+		}
+
+		// The same over the triangles [First, First + Count) of triangle_bvh::Triangles
+		GLM_FUNC_QUALIFIER static bool leaf(
+			vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+			std::vector<T> const* Triangles, std::size_t First, std::size_t Count,
+			vec<2, T, Q>& baryPosition, T& distance, std::size_t& index)
+		{
+			bool Result = false;
+			for(std::size_t i = First; i < First + Count; ++i)
+			{
+				vec<3, T, Q> const v0(Triangles[0][i], Triangles[1][i], Triangles[2][i]);
+				vec<3, T, Q> const v1(Triangles[3][i], Triangles[4][i], Triangles[5][i]);
+				vec<3, T, Q> const v2(Triangles[6][i], Triangles[7][i], Triangles[8][i]);
+				Result = intersect_nearest(orig, dir, v0, v1, v2, i, baryPosition, distance, index) || Result;
+			}
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Transposes up to a packet of vec3, Stride apart, into one packet per
+	// component. Lanes past Count repeat the last vec3. The lanes are gathered
+	// straight into registers: scalar stores to a buffer reloaded as a vector
+	// would stall on store forwarding.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void intersect_load(vec<3, float, Q> const* p, std::size_t Stride, std::size_t Count, intersect_packet Lanes[3])
+	{
+		int const FloatStride = static_cast<int>(Stride * sizeof(vec<3, float, Q>) / sizeof(float));
+		int const Last = static_cast<int>(min(Count, intersect_packet::lanes)) - 1;
+		for(length_t c = 0; c < 3; ++c)
+			Lanes[c] = intersect_packet::gather(&p[0][c], FloatStride, Last);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void intersect_broadcast(vec<3, float, Q> const& v, intersect_packet Lanes[3])
+	{
+		for(length_t c = 0; c < 3; ++c)
+			Lanes[c] = intersect_packet(v[c]);
+	}
+
+	// Keeps the nearest hit of the first Count lanes in [0, distance), lane k being triangle Base + k
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersect_nearest_packet(
+		intersect_packet const Orig[3], intersect_packet const Dir[3],
+		intersect_packet const Vert0[3], intersect_packet const Vert1[3], intersect_packet const Vert2[3],
+		std::size_t Base, std::size_t Count,
+		vec<2, float, Q>& baryPosition, float& distance, std::size_t& index)
+	{
+		intersect_packet U, V, Distance;
+		intersect_packet const Hit = intersect_ray_triangle_packet(Orig, Dir, Vert0, Vert1, Vert2, U, V, Distance);
+		int Mask = (Hit & greaterThanEqual(Distance, intersect_packet(0.0f)) & lessThan(Distance, intersect_packet(distance))).mask();
+		if(Count < intersect_packet::lanes)
+			Mask &= (1 << Count) - 1;
+		if(!Mask)
+			return false;
+
+		float TmpU[intersect_packet::lanes], TmpV[intersect_packet::lanes], TmpDistance[intersect_packet::lanes];
+		U.store(TmpU);
+		V.store(TmpV);
+		Distance.store(TmpDistance);
+		for(std::size_t k = 0; k < intersect_packet::lanes; ++k)
+		{
+			if(!((Mask >> k) & 1) || TmpDistance[k] >= distance)
+				continue;
+			baryPosition = vec<2, float, Q>(TmpU[k], TmpV[k]);
+			distance = TmpDistance[k];
+			index = Base + k;
+		}
+		return true;
+	}
+
+	template<qualifier Q>
+	struct compute_intersect_batch<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void rays(
+			vec<3, float, Q> const* orig, vec<3, float, Q> const* dir, std::size_t Count,
+			vec<3, float, Q> const& v0, vec<3, float, Q> const& v1, vec<3, float, Q> const& v2,
+			bool* Hit, vec<2, float, Q>* baryPosition, float* distance)
+		{
+			intersect_packet Vert0[3], Vert1[3], Vert2[3];
+			intersect_broadcast(v0, Vert0);
+			intersect_broadcast(v1, Vert1);
+			intersect_broadcast(v2, Vert2);
+
+			for(std::size_t i = 0; i < Count; i += intersect_packet::lanes)
+			{
+				intersect_packet Orig[3], Dir[3], U, V, Distance;
+				intersect_load(orig + i, 1, Count - i, Orig);
+				intersect_load(dir + i, 1, Count - i, Dir);
+				int const Mask = intersect_ray_triangle_packet(Orig, Dir, Vert0, Vert1, Vert2, U, V, Distance).mask();
+
+				float TmpU[intersect_packet::lanes], TmpV[intersect_packet::lanes], TmpDistance[intersect_packet::lanes];
+				U.store(TmpU);
+				V.store(TmpV);
+				Distance.store(TmpDistance);
+				for(std::size_t k = 0; k < intersect_packet::lanes && i + k < Count; ++k)
+				{
+					Hit[i + k] = (Mask >> k) & 1;
+					baryPosition[i + k] = vec<2, float, Q>(TmpU[k], TmpV[k]);
+					distance[i + k] = TmpDistance[k];
+				}
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static bool nearest(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			vec<3, float, Q> const* vertices, std::size_t Count,
+			vec<2, float, Q>& baryPosition, float& distance, std::size_t& index)
+		{
+			intersect_packet Orig[3], Dir[3];
+			intersect_broadcast(orig, Orig);
+			intersect_broadcast(dir, Dir);
+
+			bool Result = false;
+			for(std::size_t i = 0; i < Count; i += intersect_packet::lanes)
+			{
+				intersect_packet Vert0[3], Vert1[3], Vert2[3];
+				intersect_load(vertices + i * 3 + 0, 3, Count - i, Vert0);
+				intersect_load(vertices + i * 3 + 1, 3, Count - i, Vert1);
+				intersect_load(vertices + i * 3 + 2, 3, Count - i, Vert2);
+				Result = intersect_nearest_packet(Orig, Dir, Vert0, Vert1, Vert2, i, Count - i, baryPosition, distance, index) || Result;
+			}
+			return Result;
+		}
+
+		// The component arrays are padded, so the last packet of a leaf loads past its end
+		GLM_FUNC_QUALIFIER static bool leaf(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			std::vector<float> const* Triangles, std::size_t First, std::size_t Count,
+			vec<2, float, Q>& baryPosition, float& distance, std::size_t& index)
+		{
+			intersect_packet Orig[3], Dir[3];
+			intersect_broadcast(orig, Orig);
+			intersect_broadcast(dir, Dir);
+
+			bool Result = false;
+			for(std::size_t i = First; i < First + Count; i += intersect_packet::lanes)
+			{
+				intersect_packet Vert[3][3];
+				for(std::size_t k = 0; k < 9; ++k)
+					Vert[k / 3][k % 3] = intersect_packet::load(&Triangles[k][i]);
+				Result = intersect_nearest_packet(Orig, Dir, Vert[0], Vert[1], Vert[2], i, First + Count - i, baryPosition, distance, index) || Result;
+			}
+			return Result;
+		}
+	};
+#	endif
+
+	// Slab test of a ray against a box, for hits in [0, Far); Near is where the ray enters
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersect_ray_box(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, vec<3, T, Q> const& invDir,
+		vec<3, T, Q> const& Min, vec<3, T, Q> const& Max, T Far, T& Near)
+	{
+		Near = static_cast<T>(0);
+		for(length_t c = 0; c < 3; ++c)
+		{
+			// parallel to the slab: 0 * inf would be NaN
+			if(dir[c] == static_cast<T>(0))
+			{
+				if(orig[c] < Min[c] || orig[c] > Max[c])
+					return false;
+				continue;
+			}
+
+			T const t0 = (Min[c] - orig[c]) * invDir[c];
+			T const t1 = (Max[c] - orig[c]) * invDir[c];
+			Near = max(Near, min(t0, t1));
+			Far = min(Far, max(t0, t1));
+		}
+		return Near <= Far;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T intersect_half_area(vec<3, T, Q> const& Min, vec<3, T, Q> const& Max)
+	{
+		vec<3, T, Q> const Extent(Max - Min);
+		return Extent.x * Extent.y + Extent.y * Extent.z + Extent.z * Extent.x;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void intersectRayTriangle
+	(
+		vec<3, T, Q> const* orig, vec<3, T, Q> const* dir, std::size_t Count,
+		vec<3, T, Q> const& v0, vec<3, T, Q> const& v1, vec<3, T, Q> const& v2,
+		bool* Hit, vec<2, T, Q>* baryPosition, T* distance
+	)
+	{
+		detail::compute_intersect_batch<T, Q>::rays(orig, dir, Count, v0, v1, v2, Hit, baryPosition, distance);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const* vertices, std::size_t Count,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index
+	)
+	{
+		T Nearest = std::numeric_limits<T>::max();
+		if(!detail::compute_intersect_batch<T, Q>::nearest(orig, dir, vertices, Count, baryPosition, Nearest, index))
+			return false;
+		distance = Nearest;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildTriangleBVH
+	(
+		vec<3, T, Q> const* vertices, std::size_t Count,
+		triangle_bvh<T, Q>& BVH
+	)
+	{
+		typedef typename triangle_bvh<T, Q>::node node;
+
+		// Leaves of at most LeafSize triangles, a packet or two for the
+		// intersection kernel; deeper nodes than MaxDepth become leaves so that
+		// the traversal stack is bounded.
+		std::size_t const LeafSize = 8;
+		std::size_t const MaxDepth = 64;
+		int const Bins = 16;
+
+		BVH.Nodes.clear();
+		for(std::size_t k = 0; k < 9; ++k)
+			BVH.Triangles[k].clear();
+		BVH.Indices.resize(Count);
+		if(Count == 0)
+			return;
+
+		std::vector<vec<3, T, Q> > Centroids(Count, vec<3, T, Q>(static_cast<T>(0)));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			BVH.Indices[i] = i;
+			Centroids[i] = (vertices[i * 3 + 0] + vertices[i * 3 + 1] + vertices[i * 3 + 2]) / static_cast<T>(3);
+		}
+
+		// bounds are set once the node is split or made a leaf
+		node Root;
+		Root.Min = Root.Max = vec<3, T, Q>(static_cast<T>(0));
+		Root.First = 0;
+		Root.Count = Count;
+		BVH.Nodes.push_back(Root);
+
+		// nodes to split, with their depth
+		std::vector<std::pair<std::size_t, std::size_t> > Pending(1, std::make_pair(std::size_t(0), std::size_t(0)));
+		while(!Pending.empty())
+		{
+			std::size_t const Node = Pending.back().first;
+			std::size_t const Depth = Pending.back().second;
+			Pending.pop_back();
+
+			std::size_t const First = BVH.Nodes[Node].First;
+			std::size_t const NodeCount = BVH.Nodes[Node].Count;
+
+			vec<3, T, Q> Min(std::numeric_limits<T>::max()), Max(-std::numeric_limits<T>::max());
+			vec<3, T, Q> CentroidMin(Min), CentroidMax(Max);
+			for(std::size_t i = First; i < First + NodeCount; ++i)
+			{
+				std::size_t const Triangle = BVH.Indices[i];
+				for(std::size_t k = 0; k < 3; ++k)
+				{
+					Min = min(Min, vertices[Triangle * 3 + k]);
+					Max = max(Max, vertices[Triangle * 3 + k]);
+				}
+				CentroidMin = min(CentroidMin, Centroids[Triangle]);
+				CentroidMax = max(CentroidMax, Centroids[Triangle]);
+			}
+			BVH.Nodes[Node].Min = Min;
+			BVH.Nodes[Node].Max = Max;
+
+			vec<3, T, Q> const Extent(CentroidMax - CentroidMin);
+			length_t const Axis = Extent.x > Extent.y && Extent.x > Extent.z ? 0 : (Extent.y > Extent.z ? 1 : 2);
+			if(NodeCount <= LeafSize || Depth >= MaxDepth || Extent[Axis] <= static_cast<T>(0))
+				continue;
+
+			// bin the centroids along the longest axis, then take the split
+			// between bins with the lowest surface area heuristic cost
+			T const Scale = static_cast<T>(Bins) / Extent[Axis];
+			std::size_t BinCount[Bins] = {0};
+			vec<3, T, Q> BinMin[Bins], BinMax[Bins];
+			for(int b = 0; b < Bins; ++b)
+			{
+				BinMin[b] = vec<3, T, Q>(std::numeric_limits<T>::max());
+				BinMax[b] = vec<3, T, Q>(-std::numeric_limits<T>::max());
+			}
+			std::vector<int> Bin(NodeCount);
+			for(std::size_t i = 0; i < NodeCount; ++i)
+			{
+				std::size_t const Triangle = BVH.Indices[First + i];
+				Bin[i] = min(static_cast<int>((Centroids[Triangle][Axis] - CentroidMin[Axis]) * Scale), Bins - 1);
+				++BinCount[Bin[i]];
+				for(std::size_t k = 0; k < 3; ++k)
+				{
+					BinMin[Bin[i]] = min(BinMin[Bin[i]], vertices[Triangle * 3 + k]);
+					BinMax[Bin[i]] = max(BinMax[Bin[i]], vertices[Triangle * 3 + k]);
+				}
+			}
+
+			T RightCost[Bins];
+			vec<3, T, Q> BoundMin(std::numeric_limits<T>::max()), BoundMax(-std::numeric_limits<T>::max());
+			std::size_t Right = 0;
+			for(int b = Bins - 1; b > 0; --b)
+			{
+				BoundMin = min(BoundMin, BinMin[b]);
+				BoundMax = max(BoundMax, BinMax[b]);
+				Right += BinCount[b];
+				RightCost[b] = Right ? detail::intersect_half_area(BoundMin, BoundMax) * static_cast<T>(Right) : static_cast<T>(0);
+			}
+
+			int Split = 1;
+			T BestCost = std::numeric_limits<T>::max();
+			BoundMin = vec<3, T, Q>(std::numeric_limits<T>::max());
+			BoundMax = vec<3, T, Q>(-std::numeric_limits<T>::max());
+			std::size_t Left = 0;
+			for(int b = 1; b < Bins; ++b)
+			{
+				BoundMin = min(BoundMin, BinMin[b - 1]);
+				BoundMax = max(BoundMax, BinMax[b - 1]);
+				Left += BinCount[b - 1];
+				T const Cost = (Left ? detail::intersect_half_area(BoundMin, BoundMax) * static_cast<T>(Left) : static_cast<T>(0)) + RightCost[b];
+				if(Left > 0 && Left < NodeCount && Cost < BestCost)
+				{
+					BestCost = Cost;
+					Split = b;
+				}
+			}
+
+			// the first and last bins are never empty, so both sides have triangles
+			std::vector<std::size_t> Sorted;
+			Sorted.reserve(NodeCount);
+			for(std::size_t i = 0; i < NodeCount; ++i)
+				if(Bin[i] < Split)
+					Sorted.push_back(BVH.Indices[First + i]);
+			std::size_t const LeftCount = Sorted.size();
+			for(std::size_t i = 0; i < NodeCount; ++i)
+				if(Bin[i] >= Split)
+					Sorted.push_back(BVH.Indices[First + i]);
+			std::copy(Sorted.begin(), Sorted.end(), BVH.Indices.begin() + static_cast<std::ptrdiff_t>(First));
+
+			node Child;
+			Child.Min = Child.Max = Min;
+			Child.First = First;
+			Child.Count = LeftCount;
+			std::size_t const Children = BVH.Nodes.size();
+			BVH.Nodes.push_back(Child);
+			Child.First = First + LeftCount;
+			Child.Count = NodeCount - LeftCount;
+			BVH.Nodes.push_back(Child);
+			BVH.Nodes[Node].First = Children;
+			BVH.Nodes[Node].Count = 0;
+
+			Pending.push_back(std::make_pair(Children + 1, Depth + 1));
+			Pending.push_back(std::make_pair(Children, Depth + 1));
+		}
+
+		// one array per vertex coordinate in leaf order, padded with the last
+		// triangle so that packets can load past the end of the last leaf
+		for(std::size_t k = 0; k < 9; ++k)
+		{
+			BVH.Triangles[k].resize(Count + triangle_bvh<T, Q>::padding);
+			for(std::size_t i = 0; i < Count + triangle_bvh<T, Q>::padding; ++i)
+				BVH.Triangles[k][i] = vertices[BVH.Indices[min(i, Count - 1)] * 3 + k / 3][static_cast<length_t>(k % 3)];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		triangle_bvh<T, Q> const& BVH,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index
+	)
+	{
+		typedef typename triangle_bvh<T, Q>::node node;
+
+		if(BVH.Nodes.empty())
+			return false;
+
+		vec<3, T, Q> const InvDir(static_cast<T>(1) / dir);
+		T Nearest = std::numeric_limits<T>::max();
+		bool Result = false;
+
+		// nodes left to visit, with the distance where the ray enters them
+		std::size_t Stack[64];
+		T StackNear[64];
+		std::size_t Size = 0;
+
+		T RootNear(0);
+		if(!detail::intersect_ray_box(orig, dir, InvDir, BVH.Nodes[0].Min, BVH.Nodes[0].Max, Nearest, RootNear))
+			return false;
+		Stack[Size] = 0;
+		StackNear[Size++] = RootNear;
+
+		while(Size > 0)
+		{
+			--Size;
+			if(StackNear[Size] >= Nearest)
+				continue;
+			node const* Node = &BVH.Nodes[Stack[Size]];
+
+			// inner nodes: go down the nearer child, keep the farther one for later
+			while(Node->Count == 0)
+			{
+				node const& Child0 = BVH.Nodes[Node->First];
+				node const& Child1 = BVH.Nodes[Node->First + 1];
+				T Near0(0), Near1(0);
+				bool const Hit0 = detail::intersect_ray_box(orig, dir, InvDir, Child0.Min, Child0.Max, Nearest, Near0);
+				bool const Hit1 = detail::intersect_ray_box(orig, dir, InvDir, Child1.Min, Child1.Max, Nearest, Near1);
+				if(Hit0 && Hit1)
+				{
+					bool const Swap = Near1 < Near0;
+					Stack[Size] = Node->First + (Swap ? 0 : 1);
+					StackNear[Size++] = Swap ? Near0 : Near1;
+					Node = Swap ? &Child1 : &Child0;
+				}
+				else if(Hit0 || Hit1)
+					Node = Hit0 ? &Child0 : &Child1;
+				else
+					break;
+			}
+			if(Node->Count == 0)
+				continue;
+
+			std::size_t Index = 0;
+			if(detail::compute_intersect_batch<T, Q>::leaf(orig, dir, BVH.Triangles, Node->First, Node->Count, baryPosition, Nearest, Index))
+			{
+				index = BVH.Indices[Index];
+				Result = true;
+			}
+		}
+
+		if(Result)
+			distance = Nearest;
+		return Result;
+	}
+}//namespace glm
@@ -0,0 +1,82 @@
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_dual_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_batch.hpp> to use the features of this extension.
+///
+/// Multiply, interpolate and convert arrays of quaternions, and blend dual
+/// quaternions for skinning. With intrinsics enabled, float batches process
+/// four quaternions per SSE register or eight per AVX register, one per lane.
+
+#pragma once
+
+// Dependency:
+#include "../gtc/quaternion.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Compute Out[i] = A[i] * B[i] for i in [0, Count).
+	/// Out may be the same array as A or B, but the arrays must not otherwise overlap.
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(qua<T, Q> const* A, qua<T, Q> const* B, qua<T, Q>* Out, std::size_t Count);
+
+	/// Compute Out[i] = slerp(A[i], B[i], a) for i in [0, Count), along the shortest path like slerp.
+	/// Out may be the same array as A or B, but the arrays must not otherwise overlap.
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void slerpBatch(qua<T, Q> const* A, qua<T, Q> const* B, T a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Compute Out[i] = slerp(A[i], B[i], a[i]) for i in [0, Count), along the shortest path like slerp.
+	/// Out may be the same array as A or B, but the arrays must not otherwise overlap.
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void slerpBatch(qua<T, Q> const* A, qua<T, Q> const* B, T const* a, qua<T, Q>* Out, std::size_t Count);
+
+	/// Compute Out[i] = mat3_cast(In[i]) for i in [0, Count).
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat3CastBatch(qua<T, Q> const* In, mat<3, 3, T, Q>* Out, std::size_t Count);
+
+	/// Compute Out[i] = mat4_cast(In[i]) for i in [0, Count).
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat4CastBatch(qua<T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count);
+
+	/// Dual quaternion linear blending of four joints per vertex, for skinning.
+	/// Out[i] is the sum of Joints[Indices[i][k]] * Weights[i][k], each joint flipped to the
+	/// hemisphere of Joints[Indices[i][0]], divided by the length of its real part.
+	/// Unused influences need a weight of 0 and a valid index.
+	///
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void dualquatBlendBatch(tdualquat<T, Q> const* Joints, vec<4, int, Q> const* Indices, vec<4, T, Q> const* Weights, tdualquat<T, Q>* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
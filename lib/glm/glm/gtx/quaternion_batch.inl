@@ -0,0 +1,135 @@
+/// @ref gtx_quaternion_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/batch.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	struct compute_quaternion_batch
+	{
+		GLM_FUNC_QUALIFIER static void mul(qua<T, Q> const* A, qua<T, Q> const* B, qua<T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = A[i] * B[i];
+		}
+
+		// Step is 0 when every element uses a[0]
+		GLM_FUNC_QUALIFIER static void slerp(qua<T, Q> const* A, qua<T, Q> const* B, T const* a, std::size_t Step, qua<T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::slerp(A[i], B[i], a[i * Step]);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat3(qua<T, Q> const* In, mat<3, 3, T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = mat3_cast(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4(qua<T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = mat4_cast(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void blend(tdualquat<T, Q> const* Joints, vec<4, int, Q> const* Indices, vec<4, T, Q> const* Weights, tdualquat<T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				qua<T, Q> const& Pivot = Joints[Indices[i].x].real;
+				tdualquat<T, Q> Sum = Joints[Indices[i].x] * Weights[i].x;
+				for(length_t k = 1; k < 4; ++k)
+				{
+					tdualquat<T, Q> const& Joint = Joints[Indices[i][k]];
+					Sum = Sum + Joint * (dot(Joint.real, Pivot) < static_cast<T>(0) ? -Weights[i][k] : Weights[i][k]);
+				}
+				Out[i] = normalize(Sum);
+			}
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_quaternion_batch<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void mul(qua<float, Q> const* A, qua<float, Q> const* B, qua<float, Q>* Out, std::size_t Count)
+		{
+			glm_quat_mul_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), reinterpret_cast<float*>(Out), Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(qua<float, Q> const* A, qua<float, Q> const* B, float const* a, std::size_t Step, qua<float, Q>* Out, std::size_t Count)
+		{
+			glm_quat_slerp_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), a, Step, reinterpret_cast<float*>(Out), Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat3(qua<float, Q> const* In, mat<3, 3, float, Q>* Out, std::size_t Count)
+		{
+			// aligned mat3 columns are padded to four floats
+			if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+				glm_quat_mat_batch(reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), 9, Count);
+			else
+				for(std::size_t i = 0; i < Count; ++i)
+					Out[i] = mat3_cast(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4(qua<float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "mat4CastBatch requires tightly packed mat4");
+			glm_quat_mat_batch(reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), 16, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void blend(tdualquat<float, Q> const* Joints, vec<4, int, Q> const* Indices, vec<4, float, Q> const* Weights, tdualquat<float, Q>* Out, std::size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(tdualquat<float, Q>) == sizeof(float) * 8, "dualquatBlendBatch requires tightly packed dual quaternions");
+			GLM_STATIC_ASSERT(sizeof(vec<4, int, Q>) == sizeof(int) * 4, "dualquatBlendBatch requires tightly packed ivec4");
+			glm_dualquat_blend_batch(reinterpret_cast<float const*>(Joints), reinterpret_cast<int const*>(Indices), reinterpret_cast<float const*>(Weights), reinterpret_cast<float*>(Out), Count);
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(qua<T, Q> const* A, qua<T, Q> const* B, qua<T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<T, Q>) == sizeof(T) * 4, "mulBatch requires tightly packed quaternions");
+		detail::compute_quaternion_batch<T, Q>::mul(A, B, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpBatch(qua<T, Q> const* A, qua<T, Q> const* B, T a, qua<T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<T, Q>) == sizeof(T) * 4, "slerpBatch requires tightly packed quaternions");
+		detail::compute_quaternion_batch<T, Q>::slerp(A, B, &a, 0, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpBatch(qua<T, Q> const* A, qua<T, Q> const* B, T const* a, qua<T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<T, Q>) == sizeof(T) * 4, "slerpBatch requires tightly packed quaternions");
+		detail::compute_quaternion_batch<T, Q>::slerp(A, B, a, 1, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3CastBatch(qua<T, Q> const* In, mat<3, 3, T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<T, Q>) == sizeof(T) * 4, "mat3CastBatch requires tightly packed quaternions");
+		detail::compute_quaternion_batch<T, Q>::mat3(In, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4CastBatch(qua<T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<T, Q>) == sizeof(T) * 4, "mat4CastBatch requires tightly packed quaternions");
+		detail::compute_quaternion_batch<T, Q>::mat4(In, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void dualquatBlendBatch(tdualquat<T, Q> const* Joints, vec<4, int, Q> const* Indices, vec<4, T, Q> const* Weights, tdualquat<T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(vec<4, T, Q>) == sizeof(T) * 4, "dualquatBlendBatch requires tightly packed vec4");
+		detail::compute_quaternion_batch<T, Q>::blend(Joints, Indices, Weights, Out, Count);
+	}
+}//namespace glm
@@ -0,0 +1,72 @@
+/// @ref gtx_transform_batch
+/// @file glm/gtx/transform_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_batch GLM_GTX_transform_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_batch.hpp> to use the features of this extension.
+///
+/// Transform arrays of vectors by a single 4 * 4 matrix, stored either as an
+/// array of vec4 or as separate x, y, z (and w) arrays, and invert arrays of
+/// 4 * 4 matrices. With intrinsics enabled, float batches use SSE2, AVX/AVX2 or
+/// AVX-512 depending on GLM_ARCH.
+
+#pragma once
+
+// Dependency:
+#include "../mat4x4.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_transform_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_transform_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_batch
+	/// @{
+
+	/// Compute Out[i] = m * In[i] for i in [0, Count).
+	/// Out may be the same array as In, but the arrays must not otherwise overlap.
+	///
+	/// @see gtx_transform_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* In, vec<4, T, Q>* Out, std::size_t Count);
+
+	/// Structure of arrays version: (OutX[i], OutY[i], OutZ[i], OutW[i]) = m * (X[i], Y[i], Z[i], W[i]).
+	/// Each output may be the same array as an input.
+	///
+	/// @see gtx_transform_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformBatch(mat<4, 4, T, Q> const& m,
+		T const* X, T const* Y, T const* Z, T const* W,
+		T* OutX, T* OutY, T* OutZ, T* OutW, std::size_t Count);
+
+	/// Structure of arrays points with an implicit w of 1: (OutX[i], OutY[i], OutZ[i]) = (m * (X[i], Y[i], Z[i], 1)).xyz.
+	/// No perspective division is done. Each output may be the same array as an input.
+	///
+	/// @see gtx_transform_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void transformPointBatch(mat<4, 4, T, Q> const& m,
+		T const* X, T const* Y, T const* Z,
+		T* OutX, T* OutY, T* OutZ, std::size_t Count);
+
+	/// Compute Out[i] = inverse(In[i]) for i in [0, Count).
+	/// With AVX, float matrices are inverted eight at a time, one per lane.
+	/// Out may be the same array as In, but the arrays must not otherwise overlap.
+	///
+	/// @see gtx_transform_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void inverseBatch(mat<4, 4, T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "transform_batch.inl"
@@ -0,0 +1,135 @@
+/// @ref gtx_transform_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/batch.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	// m is column major, m[c * 4 + r]
+	template<typename T>
+	struct compute_transform_batch
+	{
+		GLM_FUNC_QUALIFIER static void aos(T const* m, T const* In, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const x = In[i * 4 + 0], y = In[i * 4 + 1], z = In[i * 4 + 2], w = In[i * 4 + 3];
+				for(length_t r = 0; r < 4; ++r)
+					Out[i * 4 + r] = m[0 + r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void soa(T const* m, T const* const In[4], T* const Out[4], std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const x = In[0][i], y = In[1][i], z = In[2][i], w = In[3][i];
+				for(length_t r = 0; r < 4; ++r)
+					Out[r][i] = m[0 + r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void points(T const* m, T const* const In[3], T* const Out[3], std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const x = In[0][i], y = In[1][i], z = In[2][i];
+				for(length_t r = 0; r < 3; ++r)
+					Out[r][i] = m[0 + r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r];
+			}
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_transform_batch<float>
+	{
+		GLM_FUNC_QUALIFIER static void aos(float const* m, float const* In, float* Out, std::size_t Count)
+		{
+			glm_mat4_mul_vec4_batch(m, In, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void soa(float const* m, float const* const In[4], float* const Out[4], std::size_t Count)
+		{
+			glm_mat4_mul_vec4_soa(m, In, Out, Count);
+		}
+
+		GLM_FUNC_QUALIFIER static void points(float const* m, float const* const In[3], float* const Out[3], std::size_t Count)
+		{
+			glm_mat4_mul_point3_soa(m, In, Out, Count);
+		}
+	};
+#	endif
+
+	template<typename T, qualifier Q>
+	struct compute_inverse_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = inverse(In[i]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_inverse_batch<float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, Q>) == sizeof(float) * 16, "inverseBatch requires tightly packed mat4");
+			glm_mat4_inverse_batch(reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+		}
+	};
+#	endif
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* In, vec<4, T, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(vec<4, T, Q>) == sizeof(T) * 4, "transformBatch requires tightly packed vec4");
+
+		// copy the columns in case m lives in the array being transformed
+		T Columns[16];
+		for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Columns[c * 4 + r] = m[c][r];
+		detail::compute_transform_batch<T>::aos(Columns, reinterpret_cast<T const*>(In), reinterpret_cast<T*>(Out), Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBatch(mat<4, 4, T, Q> const& m,
+		T const* X, T const* Y, T const* Z, T const* W,
+		T* OutX, T* OutY, T* OutZ, T* OutW, std::size_t Count)
+	{
+		T Columns[16];
+		for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Columns[c * 4 + r] = m[c][r];
+		T const* const In[4] = {X, Y, Z, W};
+		T* const Out[4] = {OutX, OutY, OutZ, OutW};
+		detail::compute_transform_batch<T>::soa(Columns, In, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPointBatch(mat<4, 4, T, Q> const& m,
+		T const* X, T const* Y, T const* Z,
+		T* OutX, T* OutY, T* OutZ, std::size_t Count)
+	{
+		T Columns[16];
+		for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Columns[c * 4 + r] = m[c][r];
+		T const* const In[3] = {X, Y, Z};
+		T* const Out[3] = {OutX, OutY, OutZ};
+		detail::compute_transform_batch<T>::points(Columns, In, Out, Count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseBatch(mat<4, 4, T, Q> const* In, mat<4, 4, T, Q>* Out, std::size_t Count)
+	{
+		detail::compute_inverse_batch<T, Q>::call(In, Out, Count);
+	}
+}//namespace glm
@@ -0,0 +1,802 @@
+/// @ref simd
+/// @file glm/simd/batch.h
+
+#pragma once
+
+#include "matrix.h"
+#include "trigonometric.h"
+
+#include <cstddef>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Transforms of many vectors by one column major float mat4 (m[c * 4 + r]).
+// Loads and stores are unaligned, the last few elements are handled with
+// masked loads and stores where the instruction set has them.
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// lanes [0, count) set, count <= 8
+GLM_FUNC_QUALIFIER __m256i glm_vec8_tail_mask(std::size_t count)
+{
+	__m256i const Lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	return _mm256_castps_si256(_mm256_cmp_ps(_mm256_cvtepi32_ps(Lanes), _mm256_set1_ps(static_cast<float>(count)), _CMP_LT_OQ));
+}
+#endif
+
+// out[i] = m * in[i] for count vec4, in and out as 4 * count floats; out may equal in
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_batch(float const m[16], float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	{
+		// four vectors per register, each 128 bit lane holds one
+		__m512 const c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 0));
+		__m512 const c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4));
+		__m512 const c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+		__m512 const c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+		for(; i + 4 <= count; i += 4)
+		{
+			__m512 const v = _mm512_loadu_ps(in + i * 4);
+			__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm512_storeu_ps(out + i * 4, r);
+		}
+		if(i < count)
+		{
+			__mmask16 const Mask = static_cast<__mmask16>((1u << ((count - i) * 4)) - 1u);
+			__m512 const v = _mm512_maskz_loadu_ps(Mask, in + i * 4);
+			__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm512_mask_storeu_ps(out + i * 4, Mask, r);
+		}
+		return;
+	}
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	{
+		// two vectors per register
+		__m256 const c0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+		__m256 const c1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+		__m256 const c2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+		__m256 const c3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+		for(; i + 2 <= count; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(in + i * 4);
+			__m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = glm_vec8_fma(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = glm_vec8_fma(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = glm_vec8_fma(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm256_storeu_ps(out + i * 4, r);
+		}
+	}
+#	endif
+
+	glm_vec4 const c[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(c, _mm_loadu_ps(in + i * 4)));
+}
+
+// structure of arrays: (out[0][i], .. out[3][i]) = m * (in[0][i], .. in[3][i]); outputs may equal inputs
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_soa(float const m[16], float const* const in[4], float* const out[4], std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	{
+		__m512 c[16];
+		for(int k = 0; k < 16; ++k)
+			c[k] = _mm512_set1_ps(m[k]);
+		for(; i < count; i += 16)
+		{
+			__mmask16 const Mask = count - i >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (count - i)) - 1u);
+			__m512 const x = _mm512_maskz_loadu_ps(Mask, in[0] + i);
+			__m512 const y = _mm512_maskz_loadu_ps(Mask, in[1] + i);
+			__m512 const z = _mm512_maskz_loadu_ps(Mask, in[2] + i);
+			__m512 const w = _mm512_maskz_loadu_ps(Mask, in[3] + i);
+			for(int r = 0; r < 4; ++r)
+			{
+				__m512 a = _mm512_mul_ps(c[0 + r], x);
+				a = _mm512_fmadd_ps(c[4 + r], y, a);
+				a = _mm512_fmadd_ps(c[8 + r], z, a);
+				a = _mm512_fmadd_ps(c[12 + r], w, a);
+				_mm512_mask_storeu_ps(out[r] + i, Mask, a);
+			}
+		}
+		return;
+	}
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	{
+		for(; i < count; i += 8)
+		{
+			bool const Full = count - i >= 8;
+			__m256i const Mask = glm_vec8_tail_mask(count - i);
+			__m256 const x = Full ? _mm256_loadu_ps(in[0] + i) : _mm256_maskload_ps(in[0] + i, Mask);
+			__m256 const y = Full ? _mm256_loadu_ps(in[1] + i) : _mm256_maskload_ps(in[1] + i, Mask);
+			__m256 const z = Full ? _mm256_loadu_ps(in[2] + i) : _mm256_maskload_ps(in[2] + i, Mask);
+			__m256 const w = Full ? _mm256_loadu_ps(in[3] + i) : _mm256_maskload_ps(in[3] + i, Mask);
+			for(int r = 0; r < 4; ++r)
+			{
+				__m256 a = _mm256_mul_ps(_mm256_set1_ps(m[0 + r]), x);
+				a = glm_vec8_fma(_mm256_set1_ps(m[4 + r]), y, a);
+				a = glm_vec8_fma(_mm256_set1_ps(m[8 + r]), z, a);
+				a = glm_vec8_fma(_mm256_set1_ps(m[12 + r]), w, a);
+				if(Full)
+					_mm256_storeu_ps(out[r] + i, a);
+				else
+					_mm256_maskstore_ps(out[r] + i, Mask, a);
+			}
+		}
+		return;
+	}
+#	else
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 const x = _mm_loadu_ps(in[0] + i);
+		__m128 const y = _mm_loadu_ps(in[1] + i);
+		__m128 const z = _mm_loadu_ps(in[2] + i);
+		__m128 const w = _mm_loadu_ps(in[3] + i);
+		for(int r = 0; r < 4; ++r)
+		{
+			__m128 a = _mm_mul_ps(_mm_set1_ps(m[0 + r]), x);
+			a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[4 + r]), y), a);
+			a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[8 + r]), z), a);
+			a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[12 + r]), w), a);
+			_mm_storeu_ps(out[r] + i, a);
+		}
+	}
+	for(; i < count; ++i)
+	{
+		float const x = in[0][i], y = in[1][i], z = in[2][i], w = in[3][i];
+		for(int r = 0; r < 4; ++r)
+			out[r][i] = m[0 + r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+	}
+#	endif
+}
+
+// structure of arrays points, w = 1: (out[0][i], out[1][i], out[2][i]) = (m * (in[0][i], in[1][i], in[2][i], 1)).xyz
+GLM_FUNC_QUALIFIER void glm_mat4_mul_point3_soa(float const m[16], float const* const in[3], float* const out[3], std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	{
+		__m512 c[16];
+		for(int k = 0; k < 16; ++k)
+			c[k] = _mm512_set1_ps(m[k]);
+		for(; i < count; i += 16)
+		{
+			__mmask16 const Mask = count - i >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (count - i)) - 1u);
+			__m512 const x = _mm512_maskz_loadu_ps(Mask, in[0] + i);
+			__m512 const y = _mm512_maskz_loadu_ps(Mask, in[1] + i);
+			__m512 const z = _mm512_maskz_loadu_ps(Mask, in[2] + i);
+			for(int r = 0; r < 3; ++r)
+			{
+				__m512 a = _mm512_fmadd_ps(c[0 + r], x, c[12 + r]);
+				a = _mm512_fmadd_ps(c[4 + r], y, a);
+				a = _mm512_fmadd_ps(c[8 + r], z, a);
+				_mm512_mask_storeu_ps(out[r] + i, Mask, a);
+			}
+		}
+		return;
+	}
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	{
+		for(; i < count; i += 8)
+		{
+			bool const Full = count - i >= 8;
+			__m256i const Mask = glm_vec8_tail_mask(count - i);
+			__m256 const x = Full ? _mm256_loadu_ps(in[0] + i) : _mm256_maskload_ps(in[0] + i, Mask);
+			__m256 const y = Full ? _mm256_loadu_ps(in[1] + i) : _mm256_maskload_ps(in[1] + i, Mask);
+			__m256 const z = Full ? _mm256_loadu_ps(in[2] + i) : _mm256_maskload_ps(in[2] + i, Mask);
+			for(int r = 0; r < 3; ++r)
+			{
+				__m256 a = glm_vec8_fma(_mm256_set1_ps(m[0 + r]), x, _mm256_set1_ps(m[12 + r]));
+				a = glm_vec8_fma(_mm256_set1_ps(m[4 + r]), y, a);
+				a = glm_vec8_fma(_mm256_set1_ps(m[8 + r]), z, a);
+				if(Full)
+					_mm256_storeu_ps(out[r] + i, a);
+				else
+					_mm256_maskstore_ps(out[r] + i, Mask, a);
+			}
+		}
+		return;
+	}
+#	else
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 const x = _mm_loadu_ps(in[0] + i);
+		__m128 const y = _mm_loadu_ps(in[1] + i);
+		__m128 const z = _mm_loadu_ps(in[2] + i);
+		for(int r = 0; r < 3; ++r)
+		{
+			__m128 a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0 + r]), x), _mm_set1_ps(m[12 + r]));
+			a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[4 + r]), y), a);
+			a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[8 + r]), z), a);
+			_mm_storeu_ps(out[r] + i, a);
+		}
+	}
+	for(; i < count; ++i)
+	{
+		float const x = in[0][i], y = in[1][i], z = in[2][i];
+		for(int r = 0; r < 3; ++r)
+			out[r][i] = m[0 + r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r];
+	}
+#	endif
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// transpose the 8 x 8 floats held in r0 to r7
+GLM_FUNC_QUALIFIER void glm_vec8_transpose8(__m256& r0, __m256& r1, __m256& r2, __m256& r3, __m256& r4, __m256& r5, __m256& r6, __m256& r7)
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+	__m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+	__m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+	__m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+	__m256 const t4 = _mm256_unpacklo_ps(r4, r5);
+	__m256 const t5 = _mm256_unpackhi_ps(r4, r5);
+	__m256 const t6 = _mm256_unpacklo_ps(r6, r7);
+	__m256 const t7 = _mm256_unpackhi_ps(r6, r7);
+
+	__m256 const s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+	r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+	r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+	r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+	r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+	r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+	r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+	r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+// Inverse of eight matrices at once, one per lane, m[c * 4 + r] holding that
+// element of all eight. Same cofactor expansion as glm_mat4_inverse but with
+// every product in its own lane, so nothing needs to be shuffled.
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_lanes8(__m256 const m[16], __m256 out[16])
+{
+	__m256 const Coef00 = glm_vec8_fms(m[10], m[15], _mm256_mul_ps(m[14], m[11]));
+	__m256 const Coef02 = glm_vec8_fms(m[6], m[15], _mm256_mul_ps(m[14], m[7]));
+	__m256 const Coef03 = glm_vec8_fms(m[6], m[11], _mm256_mul_ps(m[10], m[7]));
+	__m256 const Coef04 = glm_vec8_fms(m[9], m[15], _mm256_mul_ps(m[13], m[11]));
+	__m256 const Coef06 = glm_vec8_fms(m[5], m[15], _mm256_mul_ps(m[13], m[7]));
+	__m256 const Coef07 = glm_vec8_fms(m[5], m[11], _mm256_mul_ps(m[9], m[7]));
+	__m256 const Coef08 = glm_vec8_fms(m[9], m[14], _mm256_mul_ps(m[13], m[10]));
+	__m256 const Coef10 = glm_vec8_fms(m[5], m[14], _mm256_mul_ps(m[13], m[6]));
+	__m256 const Coef11 = glm_vec8_fms(m[5], m[10], _mm256_mul_ps(m[9], m[6]));
+	__m256 const Coef12 = glm_vec8_fms(m[8], m[15], _mm256_mul_ps(m[12], m[11]));
+	__m256 const Coef14 = glm_vec8_fms(m[4], m[15], _mm256_mul_ps(m[12], m[7]));
+	__m256 const Coef15 = glm_vec8_fms(m[4], m[11], _mm256_mul_ps(m[8], m[7]));
+	__m256 const Coef16 = glm_vec8_fms(m[8], m[14], _mm256_mul_ps(m[12], m[10]));
+	__m256 const Coef18 = glm_vec8_fms(m[4], m[14], _mm256_mul_ps(m[12], m[6]));
+	__m256 const Coef19 = glm_vec8_fms(m[4], m[10], _mm256_mul_ps(m[8], m[6]));
+	__m256 const Coef20 = glm_vec8_fms(m[8], m[13], _mm256_mul_ps(m[12], m[9]));
+	__m256 const Coef22 = glm_vec8_fms(m[4], m[13], _mm256_mul_ps(m[12], m[5]));
+	__m256 const Coef23 = glm_vec8_fms(m[4], m[9], _mm256_mul_ps(m[8], m[5]));
+
+	// columns of the adjugate before SignA and SignB
+	__m256 const Inv00 = glm_vec8_fma(m[7], Coef08, glm_vec8_fms(m[5], Coef00, _mm256_mul_ps(m[6], Coef04)));
+	__m256 const Inv01 = glm_vec8_fma(m[3], Coef08, glm_vec8_fms(m[1], Coef00, _mm256_mul_ps(m[2], Coef04)));
+	__m256 const Inv02 = glm_vec8_fma(m[3], Coef10, glm_vec8_fms(m[1], Coef02, _mm256_mul_ps(m[2], Coef06)));
+	__m256 const Inv03 = glm_vec8_fma(m[3], Coef11, glm_vec8_fms(m[1], Coef03, _mm256_mul_ps(m[2], Coef07)));
+	__m256 const Inv10 = glm_vec8_fma(m[7], Coef16, glm_vec8_fms(m[4], Coef00, _mm256_mul_ps(m[6], Coef12)));
+	__m256 const Inv11 = glm_vec8_fma(m[3], Coef16, glm_vec8_fms(m[0], Coef00, _mm256_mul_ps(m[2], Coef12)));
+	__m256 const Inv12 = glm_vec8_fma(m[3], Coef18, glm_vec8_fms(m[0], Coef02, _mm256_mul_ps(m[2], Coef14)));
+	__m256 const Inv13 = glm_vec8_fma(m[3], Coef19, glm_vec8_fms(m[0], Coef03, _mm256_mul_ps(m[2], Coef15)));
+	__m256 const Inv20 = glm_vec8_fma(m[7], Coef20, glm_vec8_fms(m[4], Coef04, _mm256_mul_ps(m[5], Coef12)));
+	__m256 const Inv21 = glm_vec8_fma(m[3], Coef20, glm_vec8_fms(m[0], Coef04, _mm256_mul_ps(m[1], Coef12)));
+	__m256 const Inv22 = glm_vec8_fma(m[3], Coef22, glm_vec8_fms(m[0], Coef06, _mm256_mul_ps(m[1], Coef14)));
+	__m256 const Inv23 = glm_vec8_fma(m[3], Coef23, glm_vec8_fms(m[0], Coef07, _mm256_mul_ps(m[1], Coef15)));
+	__m256 const Inv30 = glm_vec8_fma(m[6], Coef20, glm_vec8_fms(m[4], Coef08, _mm256_mul_ps(m[5], Coef16)));
+	__m256 const Inv31 = glm_vec8_fma(m[2], Coef20, glm_vec8_fms(m[0], Coef08, _mm256_mul_ps(m[1], Coef16)));
+	__m256 const Inv32 = glm_vec8_fma(m[2], Coef22, glm_vec8_fms(m[0], Coef10, _mm256_mul_ps(m[1], Coef18)));
+	__m256 const Inv33 = glm_vec8_fma(m[2], Coef23, glm_vec8_fms(m[0], Coef11, _mm256_mul_ps(m[1], Coef19)));
+
+	// the signs go into the reciprocal: element [c][r] is negated when c + r is odd
+	__m256 const Det = glm_vec8_fms(m[2], Inv20, glm_vec8_fms(m[1], Inv10, glm_vec8_fms(m[0], Inv00, _mm256_mul_ps(m[3], Inv30))));
+	__m256 const Rcp = _mm256_div_ps(_mm256_set1_ps(1.0f), Det);
+	__m256 const NegRcp = _mm256_xor_ps(Rcp, _mm256_set1_ps(-0.0f));
+
+	out[0] = _mm256_mul_ps(Inv00, Rcp);
+	out[1] = _mm256_mul_ps(Inv01, NegRcp);
+	out[2] = _mm256_mul_ps(Inv02, Rcp);
+	out[3] = _mm256_mul_ps(Inv03, NegRcp);
+	out[4] = _mm256_mul_ps(Inv10, NegRcp);
+	out[5] = _mm256_mul_ps(Inv11, Rcp);
+	out[6] = _mm256_mul_ps(Inv12, NegRcp);
+	out[7] = _mm256_mul_ps(Inv13, Rcp);
+	out[8] = _mm256_mul_ps(Inv20, Rcp);
+	out[9] = _mm256_mul_ps(Inv21, NegRcp);
+	out[10] = _mm256_mul_ps(Inv22, Rcp);
+	out[11] = _mm256_mul_ps(Inv23, NegRcp);
+	out[12] = _mm256_mul_ps(Inv30, NegRcp);
+	out[13] = _mm256_mul_ps(Inv31, Rcp);
+	out[14] = _mm256_mul_ps(Inv32, NegRcp);
+	out[15] = _mm256_mul_ps(Inv33, Rcp);
+}
+
+// eight matrices from in to out, 128 floats each; out may equal in
+GLM_FUNC_QUALIFIER void glm_mat4_inverse8(float const* in, float* out)
+{
+	// the first and last halves of each matrix are the rows of two 8 x 8 blocks
+	__m256 m[16];
+	for(int k = 0; k < 8; ++k)
+	{
+		m[k + 0] = _mm256_loadu_ps(in + k * 16 + 0);
+		m[k + 8] = _mm256_loadu_ps(in + k * 16 + 8);
+	}
+	glm_vec8_transpose8(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7]);
+	glm_vec8_transpose8(m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]);
+
+	__m256 r[16];
+	glm_mat4_inverse_lanes8(m, r);
+
+	glm_vec8_transpose8(r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7]);
+	glm_vec8_transpose8(r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15]);
+	for(int k = 0; k < 8; ++k)
+	{
+		_mm256_storeu_ps(out + k * 16 + 0, r[k + 0]);
+		_mm256_storeu_ps(out + k * 16 + 8, r[k + 8]);
+	}
+}
+#endif
+
+// out[i] = inverse(in[i]) for count column major mat4, 16 floats each; out may equal in
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_batch(float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		for(; i + 8 <= count; i += 8)
+			glm_mat4_inverse8(in + i * 16, out + i * 16);
+		if(i < count)
+		{
+			// pad the last few with identity matrices
+			float Tail[8 * 16];
+			for(std::size_t k = 0; k < 8 * 16; ++k)
+				Tail[k] = i + k / 16 < count ? in[i * 16 + k] : (k % 16) % 5 == 0 ? 1.0f : 0.0f;
+			glm_mat4_inverse8(Tail, Tail);
+			for(std::size_t k = 0; k < (count - i) * 16; ++k)
+				out[i * 16 + k] = Tail[k];
+		}
+#	else
+		for(; i < count; ++i)
+		{
+			glm_vec4 m[4], r[4];
+			for(int c = 0; c < 4; ++c)
+				m[c] = _mm_loadu_ps(in + i * 16 + c * 4);
+			glm_mat4_inverse(m, r);
+			for(int c = 0; c < 4; ++c)
+				_mm_storeu_ps(out + i * 16 + c * 4, r[c]);
+		}
+#	endif
+}
+
+// Batches of quaternions, four floats each in the storage order of glm::qua.
+// Each lane holds one quaternion: the loads transpose them into x, y, z and w
+// registers, so the arithmetic is the scalar code with no shuffles.
+
+// four quaternions from in to q[0] = x, .. q[3] = w
+GLM_FUNC_QUALIFIER void glm_quat_load4(float const* in, glm_vec4 q[4])
+{
+	glm_vec4 r0 = _mm_loadu_ps(in + 0);
+	glm_vec4 r1 = _mm_loadu_ps(in + 4);
+	glm_vec4 r2 = _mm_loadu_ps(in + 8);
+	glm_vec4 r3 = _mm_loadu_ps(in + 12);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		q[0] = r1; q[1] = r2; q[2] = r3; q[3] = r0;
+#	else
+		q[0] = r0; q[1] = r1; q[2] = r2; q[3] = r3;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_store4(float* out, glm_vec4 const q[4])
+{
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_vec4 r0 = q[3], r1 = q[0], r2 = q[1], r3 = q[2];
+#	else
+		glm_vec4 r0 = q[0], r1 = q[1], r2 = q[2], r3 = q[3];
+#	endif
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(out + 0, r0);
+	_mm_storeu_ps(out + 4, r1);
+	_mm_storeu_ps(out + 8, r2);
+	_mm_storeu_ps(out + 12, r3);
+}
+
+// r = p * q, same products as qua::operator*=
+GLM_FUNC_QUALIFIER void glm_quat_mul_lanes4(glm_vec4 const p[4], glm_vec4 const q[4], glm_vec4 r[4])
+{
+	glm_vec4 const x = _mm_sub_ps(glm_vec4_fma(p[1], q[2], glm_vec4_fma(p[0], q[3], _mm_mul_ps(p[3], q[0]))), _mm_mul_ps(p[2], q[1]));
+	glm_vec4 const y = _mm_sub_ps(glm_vec4_fma(p[2], q[0], glm_vec4_fma(p[1], q[3], _mm_mul_ps(p[3], q[1]))), _mm_mul_ps(p[0], q[2]));
+	glm_vec4 const z = _mm_sub_ps(glm_vec4_fma(p[0], q[1], glm_vec4_fma(p[2], q[3], _mm_mul_ps(p[3], q[2]))), _mm_mul_ps(p[1], q[0]));
+	glm_vec4 const w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(p[3], q[3]), _mm_mul_ps(p[0], q[0])), _mm_mul_ps(p[1], q[1])), _mm_mul_ps(p[2], q[2]));
+	r[0] = x; r[1] = y; r[2] = z; r[3] = w;
+}
+
+// the nine elements of mat3_cast(q), column major
+GLM_FUNC_QUALIFIER void glm_quat_mat3_lanes4(glm_vec4 const q[4], glm_vec4 m[9])
+{
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+	glm_vec4 const qxx = _mm_mul_ps(q[0], q[0]);
+	glm_vec4 const qyy = _mm_mul_ps(q[1], q[1]);
+	glm_vec4 const qzz = _mm_mul_ps(q[2], q[2]);
+	glm_vec4 const qxz = _mm_mul_ps(q[0], q[2]);
+	glm_vec4 const qxy = _mm_mul_ps(q[0], q[1]);
+	glm_vec4 const qyz = _mm_mul_ps(q[1], q[2]);
+	glm_vec4 const qwx = _mm_mul_ps(q[3], q[0]);
+	glm_vec4 const qwy = _mm_mul_ps(q[3], q[1]);
+	glm_vec4 const qwz = _mm_mul_ps(q[3], q[2]);
+
+	m[0] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qyy, qzz)));
+	m[1] = _mm_mul_ps(Two, _mm_add_ps(qxy, qwz));
+	m[2] = _mm_mul_ps(Two, _mm_sub_ps(qxz, qwy));
+	m[3] = _mm_mul_ps(Two, _mm_sub_ps(qxy, qwz));
+	m[4] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qxx, qzz)));
+	m[5] = _mm_mul_ps(Two, _mm_add_ps(qyz, qwx));
+	m[6] = _mm_mul_ps(Two, _mm_add_ps(qxz, qwy));
+	m[7] = _mm_mul_ps(Two, _mm_sub_ps(qyz, qwx));
+	m[8] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qxx, qyy)));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// eight quaternions from in to q[0] = x, .. q[3] = w
+GLM_FUNC_QUALIFIER void glm_quat_load8(float const* in, __m256 q[4])
+{
+	__m256 const r0 = _mm256_loadu_ps(in + 0);
+	__m256 const r1 = _mm256_loadu_ps(in + 8);
+	__m256 const r2 = _mm256_loadu_ps(in + 16);
+	__m256 const r3 = _mm256_loadu_ps(in + 24);
+
+	// quaternions i and i + 4 side by side, then a 4 x 4 transpose in each half
+	__m256 const a = _mm256_permute2f128_ps(r0, r2, 0x20);
+	__m256 const b = _mm256_permute2f128_ps(r0, r2, 0x31);
+	__m256 const c = _mm256_permute2f128_ps(r1, r3, 0x20);
+	__m256 const d = _mm256_permute2f128_ps(r1, r3, 0x31);
+	__m256 const t0 = _mm256_unpacklo_ps(a, b);
+	__m256 const t1 = _mm256_unpacklo_ps(c, d);
+	__m256 const t2 = _mm256_unpackhi_ps(a, b);
+	__m256 const t3 = _mm256_unpackhi_ps(c, d);
+	__m256 const s0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		q[0] = s1; q[1] = s2; q[2] = s3; q[3] = s0;
+#	else
+		q[0] = s0; q[1] = s1; q[2] = s2; q[3] = s3;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_store8(float* out, __m256 const q[4])
+{
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		__m256 const s0 = q[3], s1 = q[0], s2 = q[1], s3 = q[2];
+#	else
+		__m256 const s0 = q[0], s1 = q[1], s2 = q[2], s3 = q[3];
+#	endif
+	__m256 const t0 = _mm256_unpacklo_ps(s0, s1);
+	__m256 const t1 = _mm256_unpacklo_ps(s2, s3);
+	__m256 const t2 = _mm256_unpackhi_ps(s0, s1);
+	__m256 const t3 = _mm256_unpackhi_ps(s2, s3);
+	__m256 const a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	_mm256_storeu_ps(out + 0, _mm256_permute2f128_ps(a, b, 0x20));
+	_mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(c, d, 0x20));
+	_mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(a, b, 0x31));
+	_mm256_storeu_ps(out + 24, _mm256_permute2f128_ps(c, d, 0x31));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_mul_lanes8(__m256 const p[4], __m256 const q[4], __m256 r[4])
+{
+	__m256 const x = _mm256_sub_ps(glm_vec8_fma(p[1], q[2], glm_vec8_fma(p[0], q[3], _mm256_mul_ps(p[3], q[0]))), _mm256_mul_ps(p[2], q[1]));
+	__m256 const y = _mm256_sub_ps(glm_vec8_fma(p[2], q[0], glm_vec8_fma(p[1], q[3], _mm256_mul_ps(p[3], q[1]))), _mm256_mul_ps(p[0], q[2]));
+	__m256 const z = _mm256_sub_ps(glm_vec8_fma(p[0], q[1], glm_vec8_fma(p[2], q[3], _mm256_mul_ps(p[3], q[2]))), _mm256_mul_ps(p[1], q[0]));
+	__m256 const w = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_mul_ps(p[3], q[3]), _mm256_mul_ps(p[0], q[0])), _mm256_mul_ps(p[1], q[1])), _mm256_mul_ps(p[2], q[2]));
+	r[0] = x; r[1] = y; r[2] = z; r[3] = w;
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_mat3_lanes8(__m256 const q[4], __m256 m[9])
+{
+	__m256 const One = _mm256_set1_ps(1.0f);
+	__m256 const Two = _mm256_set1_ps(2.0f);
+	__m256 const qxx = _mm256_mul_ps(q[0], q[0]);
+	__m256 const qyy = _mm256_mul_ps(q[1], q[1]);
+	__m256 const qzz = _mm256_mul_ps(q[2], q[2]);
+	__m256 const qxz = _mm256_mul_ps(q[0], q[2]);
+	__m256 const qxy = _mm256_mul_ps(q[0], q[1]);
+	__m256 const qyz = _mm256_mul_ps(q[1], q[2]);
+	__m256 const qwx = _mm256_mul_ps(q[3], q[0]);
+	__m256 const qwy = _mm256_mul_ps(q[3], q[1]);
+	__m256 const qwz = _mm256_mul_ps(q[3], q[2]);
+
+	m[0] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qyy, qzz)));
+	m[1] = _mm256_mul_ps(Two, _mm256_add_ps(qxy, qwz));
+	m[2] = _mm256_mul_ps(Two, _mm256_sub_ps(qxz, qwy));
+	m[3] = _mm256_mul_ps(Two, _mm256_sub_ps(qxy, qwz));
+	m[4] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qxx, qzz)));
+	m[5] = _mm256_mul_ps(Two, _mm256_add_ps(qyz, qwx));
+	m[6] = _mm256_mul_ps(Two, _mm256_add_ps(qxz, qwy));
+	m[7] = _mm256_mul_ps(Two, _mm256_sub_ps(qyz, qwx));
+	m[8] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qxx, qyy)));
+}
+#endif
+
+// out[i] = a[i] * b[i] for count quaternions; out may equal a or b
+GLM_FUNC_QUALIFIER void glm_quat_mul_batch(float const* a, float const* b, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 p[4], q[4], r[4];
+			glm_quat_load8(a + i * 4, p);
+			glm_quat_load8(b + i * 4, q);
+			glm_quat_mul_lanes8(p, q, r);
+			glm_quat_store8(out + i * 4, r);
+		}
+#	endif
+
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 p[4], q[4], r[4];
+		glm_quat_load4(a + i * 4, p);
+		glm_quat_load4(b + i * 4, q);
+		glm_quat_mul_lanes4(p, q, r);
+		glm_quat_store4(out + i * 4, r);
+	}
+
+	if(i < count)
+	{
+		float TailA[16] = {0}, TailB[16] = {0};
+		for(std::size_t k = 0; k < (count - i) * 4; ++k)
+		{
+			TailA[k] = a[i * 4 + k];
+			TailB[k] = b[i * 4 + k];
+		}
+		glm_vec4 p[4], q[4], r[4];
+		glm_quat_load4(TailA, p);
+		glm_quat_load4(TailB, q);
+		glm_quat_mul_lanes4(p, q, r);
+		glm_quat_store4(TailA, r);
+		for(std::size_t k = 0; k < (count - i) * 4; ++k)
+			out[i * 4 + k] = TailA[k];
+	}
+}
+
+// Same shortest path and linear fallback as glm::slerp, with the angle from
+// atan2 and the sines from the polynomial kernels of trigonometric.h
+GLM_FUNC_QUALIFIER void glm_quat_slerp_lanes4(glm_vec4 const p[4], glm_vec4 const q[4], glm_vec4 t, glm_vec4 r[4])
+{
+	glm_vec4 CosTheta = _mm_mul_ps(p[0], q[0]);
+	CosTheta = glm_vec4_fma(p[1], q[1], CosTheta);
+	CosTheta = glm_vec4_fma(p[2], q[2], CosTheta);
+	CosTheta = glm_vec4_fma(p[3], q[3], CosTheta);
+	glm_vec4 const Sign = _mm_and_ps(CosTheta, _mm_set1_ps(-0.0f));
+	CosTheta = _mm_xor_ps(CosTheta, Sign);
+
+	glm_vec4 const SinTheta = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(CosTheta, CosTheta)), _mm_setzero_ps()));
+	glm_vec4 const Angle = glm_vec4_atan2(SinTheta, CosTheta);
+	glm_vec4 const OneMinusT = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+	glm_vec4 const Rcp = _mm_div_ps(_mm_set1_ps(1.0f), SinTheta);
+	glm_vec4 const Linear = _mm_cmpgt_ps(CosTheta, _mm_set1_ps(1.0f - 1.1920928955078125e-7f));
+	glm_vec4 const w0 = glm_vec4_select(Linear, OneMinusT, _mm_mul_ps(glm_vec4_sin(_mm_mul_ps(OneMinusT, Angle)), Rcp));
+	glm_vec4 const w1 = _mm_xor_ps(glm_vec4_select(Linear, t, _mm_mul_ps(glm_vec4_sin(_mm_mul_ps(t, Angle)), Rcp)), Sign);
+
+	for(int c = 0; c < 4; ++c)
+		r[c] = glm_vec4_fma(p[c], w0, _mm_mul_ps(q[c], w1));
+}
+
+// out[i] = slerp(a[i], b[i], t[i * step]) for count quaternions, step 0 for a
+// single factor; out may equal a or b
+GLM_FUNC_QUALIFIER void glm_quat_slerp_batch(float const* a, float const* b, float const* t, std::size_t step, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		glm_vec4 p[4], q[4], r[4];
+		glm_quat_load4(a + i * 4, p);
+		glm_quat_load4(b + i * 4, q);
+		glm_quat_slerp_lanes4(p, q, step ? _mm_loadu_ps(t + i) : _mm_set1_ps(*t), r);
+		glm_quat_store4(out + i * 4, r);
+	}
+
+	if(i < count)
+	{
+		float TailA[16] = {0}, TailB[16] = {0}, TailT[4] = {0};
+		for(std::size_t k = 0; k < count - i; ++k)
+		{
+			for(std::size_t c = 0; c < 4; ++c)
+			{
+				TailA[k * 4 + c] = a[(i + k) * 4 + c];
+				TailB[k * 4 + c] = b[(i + k) * 4 + c];
+			}
+			TailT[k] = t[(i + k) * step];
+		}
+		glm_vec4 p[4], q[4], r[4];
+		glm_quat_load4(TailA, p);
+		glm_quat_load4(TailB, q);
+		glm_quat_slerp_lanes4(p, q, _mm_loadu_ps(TailT), r);
+		glm_quat_store4(TailA, r);
+		for(std::size_t k = 0; k < (count - i) * 4; ++k)
+			out[i * 4 + k] = TailA[k];
+	}
+}
+
+// stores the first count of the four matrices in m as size 9 (mat3) or 16 (mat4) floats each
+GLM_FUNC_QUALIFIER void glm_quat_mat_store4(glm_vec4 const m[9], float* out, std::size_t size, std::size_t count)
+{
+	// column major 4 * 4 with the 3 * 3 in the upper left, or the 3 * 3 itself
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 e[16];
+	if(size == 16)
+	{
+		e[0] = m[0]; e[1] = m[1]; e[2] = m[2]; e[3] = Zero;
+		e[4] = m[3]; e[5] = m[4]; e[6] = m[5]; e[7] = Zero;
+		e[8] = m[6]; e[9] = m[7]; e[10] = m[8]; e[11] = Zero;
+		e[12] = Zero; e[13] = Zero; e[14] = Zero; e[15] = _mm_set1_ps(1.0f);
+	}
+	else
+	{
+		for(int k = 0; k < 9; ++k)
+			e[k] = m[k];
+		for(int k = 9; k < 16; ++k)
+			e[k] = Zero;
+	}
+
+	// four groups of four elements, transposed so each register is one matrix;
+	// a full 3 * 3 group stores the first two and the ninth element by itself
+	bool const Full = count == 4;
+	int const Groups = Full ? (size == 9 ? 2 : 3) : 4;
+	float Tail[4 * 16];
+	for(int g = 0; g < Groups; ++g)
+	{
+		glm_vec4 r0 = e[g * 4 + 0], r1 = e[g * 4 + 1], r2 = e[g * 4 + 2], r3 = e[g * 4 + 3];
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		float* Dst = Full ? out : Tail;
+		std::size_t const Stride = Full ? size : 16;
+		_mm_storeu_ps(Dst + 0 * Stride + g * 4, r0);
+		_mm_storeu_ps(Dst + 1 * Stride + g * 4, r1);
+		_mm_storeu_ps(Dst + 2 * Stride + g * 4, r2);
+		_mm_storeu_ps(Dst + 3 * Stride + g * 4, r3);
+	}
+	if(Full)
+	{
+		if(size == 9)
+		{
+			float Last[4];
+			_mm_storeu_ps(Last, e[8]);
+			for(int k = 0; k < 4; ++k)
+				out[k * 9 + 8] = Last[k];
+		}
+		else
+		{
+			// the last column is the same for every matrix
+			glm_vec4 const Column = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			for(int k = 0; k < 4; ++k)
+				_mm_storeu_ps(out + k * 16 + 12, Column);
+		}
+		return;
+	}
+	for(std::size_t k = 0; k < count; ++k)
+		for(std::size_t j = 0; j < size; ++j)
+			out[k * size + j] = Tail[k * 16 + j];
+}
+
+// out[i] = mat3_cast(in[i]) or mat4_cast(in[i]), column major, size 9 or 16
+// floats each; in and out must not overlap
+GLM_FUNC_QUALIFIER void glm_quat_mat_batch(float const* in, float* out, std::size_t size, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 q[4], m[16];
+			glm_quat_load8(in + i * 4, q);
+			glm_quat_mat3_lanes8(q, m);
+			if(size == 16)
+			{
+				// same transposes as glm_mat4_inverse8
+				__m256 const Zero = _mm256_setzero_ps();
+				__m256 r[16] = {m[0], m[1], m[2], Zero, m[3], m[4], m[5], Zero, m[6], m[7], m[8], Zero, Zero, Zero, Zero, _mm256_set1_ps(1.0f)};
+				glm_vec8_transpose8(r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7]);
+				glm_vec8_transpose8(r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15]);
+				for(int k = 0; k < 8; ++k)
+				{
+					_mm256_storeu_ps(out + (i + k) * 16 + 0, r[k + 0]);
+					_mm256_storeu_ps(out + (i + k) * 16 + 8, r[k + 8]);
+				}
+			}
+			else
+			{
+				// the first eight elements of each matrix, then the ninth
+				glm_vec8_transpose8(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7]);
+				float Last[8];
+				_mm256_storeu_ps(Last, m[8]);
+				for(int k = 0; k < 8; ++k)
+				{
+					_mm256_storeu_ps(out + (i + k) * 9, m[k]);
+					out[(i + k) * 9 + 8] = Last[k];
+				}
+			}
+		}
+#	endif
+
+	for(; i < count; i += 4)
+	{
+		glm_vec4 q[4], m[9];
+		if(count - i >= 4)
+			glm_quat_load4(in + i * 4, q);
+		else
+		{
+			float Tail[16] = {0};
+			for(std::size_t k = 0; k < (count - i) * 4; ++k)
+				Tail[k] = in[i * 4 + k];
+			glm_quat_load4(Tail, q);
+		}
+		glm_quat_mat3_lanes4(q, m);
+		glm_quat_mat_store4(m, out + i * size, size, count - i < 4 ? count - i : 4);
+	}
+}
+
+// Dual quaternion linear blending for skinning: out[i] is the sum of four
+// joints[indices[i * 4 + k]], 8 floats each (real then dual part), weighted by
+// weights[i * 4 + k] and flipped to the hemisphere of the first one, divided by
+// the length of its real part. Dot products and lengths don't depend on the
+// component order, so neither does this.
+GLM_FUNC_QUALIFIER void glm_dualquat_blend_batch(float const* joints, int const* indices, float const* weights, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; ++i)
+	{
+		int const* Index = indices + i * 4;
+		float const* Weight = weights + i * 4;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const j0 = _mm256_loadu_ps(joints + Index[0] * 8);
+			glm_vec4 const r0 = _mm256_castps256_ps128(j0);
+			__m256 Sum = _mm256_mul_ps(j0, _mm256_set1_ps(Weight[0]));
+			for(int k = 1; k < 4; ++k)
+			{
+				__m256 const j = _mm256_loadu_ps(joints + Index[k] * 8);
+				glm_vec4 const Sign = _mm_and_ps(glm_vec4_dot(_mm256_castps256_ps128(j), r0), _mm_set1_ps(-0.0f));
+				glm_vec4 const w = _mm_xor_ps(_mm_set1_ps(Weight[k]), Sign);
+				Sum = glm_vec8_fma(j, _mm256_insertf128_ps(_mm256_castps128_ps256(w), w, 1), Sum);
+			}
+			glm_vec4 const Length = _mm_sqrt_ps(glm_vec4_dot(_mm256_castps256_ps128(Sum), _mm256_castps256_ps128(Sum)));
+			_mm256_storeu_ps(out + i * 8, _mm256_div_ps(Sum, _mm256_insertf128_ps(_mm256_castps128_ps256(Length), Length, 1)));
+#		else
+			glm_vec4 const r0 = _mm_loadu_ps(joints + Index[0] * 8);
+			glm_vec4 Real = _mm_mul_ps(r0, _mm_set1_ps(Weight[0]));
+			glm_vec4 Dual = _mm_mul_ps(_mm_loadu_ps(joints + Index[0] * 8 + 4), _mm_set1_ps(Weight[0]));
+			for(int k = 1; k < 4; ++k)
+			{
+				glm_vec4 const r = _mm_loadu_ps(joints + Index[k] * 8);
+				glm_vec4 const Sign = _mm_and_ps(glm_vec4_dot(r, r0), _mm_set1_ps(-0.0f));
+				glm_vec4 const w = _mm_xor_ps(_mm_set1_ps(Weight[k]), Sign);
+				Real = glm_vec4_fma(r, w, Real);
+				Dual = glm_vec4_fma(_mm_loadu_ps(joints + Index[k] * 8 + 4), w, Dual);
+			}
+			glm_vec4 const Length = _mm_sqrt_ps(glm_vec4_dot(Real, Real));
+			_mm_storeu_ps(out + i * 8 + 0, _mm_div_ps(Real, Length));
+			_mm_storeu_ps(out + i * 8 + 4, _mm_div_ps(Dual, Length));
+#		endif
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -79,6 +79,71 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fma(glm_f32vec4 a, glm_f32vec4 b, glm_f3
 #	endif
 }
 
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_SIMD_FMA 1
+#else
+#	define GLM_SIMD_FMA 0
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// a * b + c
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	if GLM_SIMD_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+// a * b - c
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fms(__m256 a, __m256 b, __m256 c)
+{
+#	if GLM_SIMD_FMA
+		return _mm256_fmsub_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+// a * b + c
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fma(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	if GLM_SIMD_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+
+// a * b - c
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fms(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	if GLM_SIMD_FMA
+		return _mm256_fmsub_pd(a, b, c);
+#	else
+		return _mm256_sub_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+#endif
+
+// a where the lanes of mask are all ones, b where they are all zeros
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#	endif
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_select(glm_dvec4 mask, glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_blendv_pd(b, a, mask);
+}
+#endif
+
 GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_abs(glm_f32vec4 x)
 {
 	return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +17,241 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// Polynomial exponential and natural logarithm: Cephes for single precision,
+// fdlibm for double precision. exp scales by 2^k in two steps so that large
+// results still overflow to infinity and small ones round to denormals or 0.
+// log handles denormals, returns -inf for 0 and NaN for negative inputs.
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	// min and max return their second operand for NaN, which keeps it in x
+	glm_vec4 const clp0 = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(88.8f), x));
+
+	// x = k * ln(2) + r, |r| <= ln(2) / 2
+	glm_ivec4 const k = _mm_cvtps_epi32(_mm_mul_ps(clp0, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const fk = _mm_cvtepi32_ps(k);
+	glm_vec4 r = glm_vec4_fma(fk, _mm_set1_ps(-0.693359375f), clp0);
+	r = glm_vec4_fma(fk, _mm_set1_ps(2.12194440e-4f), r);
+	glm_vec4 const rr = _mm_mul_ps(r, r);
+
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const y = _mm_add_ps(glm_vec4_fma(p, rr, r), _mm_set1_ps(1.0f));
+
+	glm_ivec4 const k1 = _mm_srai_epi32(k, 1);
+	glm_ivec4 const k2 = _mm_sub_epi32(k, k1);
+	glm_vec4 const s1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(k1, _mm_set1_epi32(127)), 23));
+	glm_vec4 const s2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(k2, _mm_set1_epi32(127)), 23));
+	return _mm_mul_ps(_mm_mul_ps(y, s1), s2);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	// Denormals are scaled by 2^23 first
+	glm_vec4 const den0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const xs = glm_vec4_select(den0, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x);
+	glm_ivec4 const bits = _mm_castps_si128(xs);
+
+	// x = m * 2^e with m in [0.5, 1), then m in [sqrt(1/2), sqrt(2)) - 1
+	glm_ivec4 const e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126));
+	glm_vec4 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+	glm_vec4 const sml0 = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	glm_vec4 fe = _mm_sub_ps(_mm_cvtepi32_ps(e), _mm_and_ps(den0, _mm_set1_ps(23.0f)));
+	fe = _mm_sub_ps(fe, _mm_and_ps(sml0, _mm_set1_ps(1.0f)));
+	m = _mm_add_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_and_ps(sml0, m));
+	glm_vec4 const mm = _mm_mul_ps(m, m);
+
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 y = _mm_mul_ps(_mm_mul_ps(p, mm), m);
+	y = glm_vec4_fma(fe, _mm_set1_ps(-2.12194440e-4f), y);
+	y = glm_vec4_fma(mm, _mm_set1_ps(-0.5f), y);
+	glm_vec4 r = _mm_add_ps(m, y);
+	r = glm_vec4_fma(fe, _mm_set1_ps(0.693359375f), r);
+
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7f800000));
+	r = glm_vec4_select(_mm_cmpeq_ps(x, inf0), inf0, r);
+	r = glm_vec4_select(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), inf0), r);
+	return glm_vec4_select(_mm_cmpnge_ps(x, _mm_setzero_ps()), _mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), r);
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_exp(glm_dvec4 x)
+{
+	glm_dvec4 const clp0 = _mm256_max_pd(_mm256_set1_pd(-746.0), _mm256_min_pd(_mm256_set1_pd(710.0), x));
+
+	glm_dvec4 const fk = _mm256_round_pd(_mm256_mul_pd(clp0, _mm256_set1_pd(1.44269504088896338700)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_dvec4 const hi = glm_dvec4_fma(fk, _mm256_set1_pd(-6.93147180369123816490e-01), clp0);
+	glm_dvec4 const lo = _mm256_mul_pd(fk, _mm256_set1_pd(1.90821492927058770002e-10));
+	glm_dvec4 const r = _mm256_sub_pd(hi, lo);
+	glm_dvec4 const rr = _mm256_mul_pd(r, r);
+
+	glm_dvec4 p = glm_dvec4_fma(_mm256_set1_pd(4.13813679705723846039e-08), rr, _mm256_set1_pd(-1.65339022054652515390e-06));
+	p = glm_dvec4_fma(p, rr, _mm256_set1_pd(6.61375632143793436117e-05));
+	p = glm_dvec4_fma(p, rr, _mm256_set1_pd(-2.77777777770155933842e-03));
+	p = glm_dvec4_fma(p, rr, _mm256_set1_pd(1.66666666666666019037e-01));
+	glm_dvec4 const c = glm_dvec4_fma(_mm256_sub_pd(_mm256_setzero_pd(), rr), p, r);
+	glm_dvec4 const rc = _mm256_div_pd(_mm256_mul_pd(r, c), _mm256_sub_pd(_mm256_set1_pd(2.0), c));
+	glm_dvec4 const y = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_sub_pd(_mm256_sub_pd(lo, rc), hi));
+
+	__m128i const k = _mm256_cvtpd_epi32(fk);
+	__m128i const k1 = _mm_srai_epi32(k, 1);
+	__m128i const k2 = _mm_sub_epi32(k, k1);
+	glm_dvec4 const s1 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(_mm_add_epi32(k1, _mm_set1_epi32(1023))), 52));
+	glm_dvec4 const s2 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(_mm_add_epi32(k2, _mm_set1_epi32(1023))), 52));
+	return _mm256_mul_pd(_mm256_mul_pd(y, s1), s2);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_log(glm_dvec4 x)
+{
+	glm_dvec4 const den0 = _mm256_cmp_pd(x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+	glm_dvec4 const xs = glm_dvec4_select(den0, _mm256_mul_pd(x, _mm256_set1_pd(18014398509481984.0)), x);
+	__m256i const bits = _mm256_castpd_si256(xs);
+
+	// x = m * 2^e with m in [1, 2), then m in [sqrt(1/2), sqrt(2))
+	__m256i const e64 = _mm256_sub_epi64(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(1023));
+	__m128i const e = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(e64, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+	glm_dvec4 m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffffLL)), _mm256_set1_epi64x(0x3ff0000000000000LL)));
+	glm_dvec4 const big0 = _mm256_cmp_pd(m, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ);
+	m = glm_dvec4_select(big0, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), m);
+	glm_dvec4 k = _mm256_sub_pd(_mm256_cvtepi32_pd(e), _mm256_and_pd(den0, _mm256_set1_pd(54.0)));
+	k = _mm256_add_pd(k, _mm256_and_pd(big0, _mm256_set1_pd(1.0)));
+
+	glm_dvec4 const f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+	glm_dvec4 const s = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+	glm_dvec4 const z = _mm256_mul_pd(s, s);
+	glm_dvec4 const w = _mm256_mul_pd(z, z);
+	glm_dvec4 t1 = glm_dvec4_fma(w, _mm256_set1_pd(1.531383769920937332e-01), _mm256_set1_pd(2.222219843214978396e-01));
+	t1 = glm_dvec4_fma(w, t1, _mm256_set1_pd(3.999999999940941908e-01));
+	t1 = _mm256_mul_pd(w, t1);
+	glm_dvec4 t2 = glm_dvec4_fma(w, _mm256_set1_pd(1.479819860511658591e-01), _mm256_set1_pd(1.818357216161805012e-01));
+	t2 = glm_dvec4_fma(w, t2, _mm256_set1_pd(2.857142874366239149e-01));
+	t2 = glm_dvec4_fma(w, t2, _mm256_set1_pd(6.666666666666735130e-01));
+	t2 = _mm256_mul_pd(z, t2);
+	glm_dvec4 const R = _mm256_add_pd(t2, t1);
+	glm_dvec4 const hfsq = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+
+	// k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f)
+	glm_dvec4 const lo = glm_dvec4_fma(s, _mm256_add_pd(hfsq, R), _mm256_mul_pd(k, _mm256_set1_pd(1.90821492927058770002e-10)));
+	glm_dvec4 r = _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(6.93147180369123816490e-01)), _mm256_sub_pd(_mm256_sub_pd(hfsq, lo), f));
+
+	glm_dvec4 const inf0 = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL));
+	r = glm_dvec4_select(_mm256_cmp_pd(x, inf0, _CMP_EQ_OQ), inf0, r);
+	r = glm_dvec4_select(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_sub_pd(_mm256_setzero_pd(), inf0), r);
+	return glm_dvec4_select(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_NGE_UQ), _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff8000000000000LL)), r);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_pow(glm_dvec4 x, glm_dvec4 y)
+{
+	glm_dvec4 const abs0 = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+	glm_dvec4 const pow0 = glm_dvec4_exp(_mm256_mul_pd(y, glm_dvec4_log(abs0)));
+
+	glm_dvec4 const hlf0 = _mm256_mul_pd(y, _mm256_set1_pd(0.5));
+	glm_dvec4 const int0 = _mm256_cmp_pd(_mm256_round_pd(y, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), y, _CMP_EQ_OQ);
+	glm_dvec4 const odd0 = _mm256_cmp_pd(_mm256_round_pd(hlf0, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), hlf0, _CMP_NEQ_UQ);
+	glm_dvec4 const neg0 = _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ);
+
+	// The sign of x, -0 included, carries over for odd integer y
+	glm_dvec4 const sgn0 = _mm256_and_pd(_mm256_and_pd(x, _mm256_and_pd(int0, odd0)), _mm256_set1_pd(-0.0));
+	glm_dvec4 const pow1 = glm_dvec4_select(_mm256_andnot_pd(int0, neg0), _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff8000000000000LL)), _mm256_xor_pd(pow0, sgn0));
+
+	// 1 for y = 0, x = 1 and |x| = 1 with infinite y, even where the other operand is NaN
+	glm_dvec4 const one0 = _mm256_set1_pd(1.0);
+	glm_dvec4 const inf0 = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL));
+	glm_dvec4 const abs1 = _mm256_cmp_pd(abs0, one0, _CMP_EQ_OQ);
+	glm_dvec4 const infy = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), y), inf0, _CMP_EQ_OQ);
+	glm_dvec4 unit0 = _mm256_or_pd(_mm256_cmp_pd(y, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_cmp_pd(x, one0, _CMP_EQ_OQ));
+	unit0 = _mm256_or_pd(unit0, _mm256_and_pd(abs1, infy));
+	return glm_dvec4_select(unit0, one0, pow1);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+// exp(y * log(x)) for positive float x in double precision. The float result only
+// needs y * log(x) to about 1e-10, so this is shorter than glm_dvec4_log and
+// glm_dvec4_exp: a degree 11 log and a degree 7 exp, and no split 2^k scaling
+// as the float conversion rounds the out of range results to infinity or 0.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow_positive(glm_vec4 x, glm_vec4 y)
+{
+	// Float denormals are scaled by 2^23, then x = m * 2^e with m in [sqrt(1/2), sqrt(2))
+	glm_vec4 const den0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_ivec4 const bits = _mm_castps_si128(glm_vec4_select(den0, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x));
+	glm_ivec4 const e = _mm_srai_epi32(_mm_sub_epi32(bits, _mm_set1_epi32(0x3f3504f3)), 23);
+	glm_dvec4 const m = _mm256_cvtps_pd(_mm_castsi128_ps(_mm_sub_epi32(bits, _mm_slli_epi32(e, 23))));
+	glm_dvec4 const k = _mm256_cvtepi32_pd(_mm_sub_epi32(e, _mm_and_si128(_mm_castps_si128(den0), _mm_set1_epi32(23))));
+
+	// log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1)
+	glm_dvec4 const f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+	glm_dvec4 const s = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+	glm_dvec4 const z = _mm256_mul_pd(s, s);
+	glm_dvec4 p = glm_dvec4_fma(z, _mm256_set1_pd(2.0 / 11.0), _mm256_set1_pd(2.0 / 9.0));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.0 / 7.0));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.0 / 5.0));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.0 / 3.0));
+	glm_dvec4 const log0 = glm_dvec4_fma(k, _mm256_set1_pd(6.93147180559945309417e-1), glm_dvec4_fma(_mm256_mul_pd(s, z), p, _mm256_add_pd(s, s)));
+
+	// log(0) is -inf, log(inf) and log(NaN) are x
+	glm_dvec4 const xd = _mm256_cvtps_pd(x);
+	glm_dvec4 const inf0 = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL));
+	glm_dvec4 log1 = glm_dvec4_select(_mm256_cmp_pd(xd, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_sub_pd(_mm256_setzero_pd(), inf0), log0);
+	log1 = glm_dvec4_select(_mm256_cmp_pd(xd, inf0, _CMP_NLT_UQ), xd, log1);
+
+	// min and max return their second operand for NaN, which keeps it in t
+	glm_dvec4 const t = _mm256_max_pd(_mm256_set1_pd(-200.0), _mm256_min_pd(_mm256_set1_pd(200.0), _mm256_mul_pd(_mm256_cvtps_pd(y), log1)));
+	glm_dvec4 const n = _mm256_round_pd(_mm256_mul_pd(t, _mm256_set1_pd(1.44269504088896340736)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_dvec4 const r = glm_dvec4_fma(n, _mm256_set1_pd(-6.93147180559945309417e-1), t);
+	glm_dvec4 q = glm_dvec4_fma(r, _mm256_set1_pd(1.0 / 5040.0), _mm256_set1_pd(1.0 / 720.0));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(1.0 / 120.0));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(1.0 / 24.0));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(1.0 / 6.0));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(0.5));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(1.0));
+	q = glm_dvec4_fma(q, r, _mm256_set1_pd(1.0));
+
+	__m256i const scl0 = _mm256_slli_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n)), 52);
+	return _mm256_cvtpd_ps(_mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(q), scl0)));
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// pow(x, y) = exp(y * log(|x|)), negated for negative x and odd integer y, NaN
+// for negative x and fractional y and 1 when y is 0. The error of log(x) is
+// scaled by y * log(x), so with AVX2 the float version runs in double precision.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		glm_vec4 const pow0 = glm_vec4_pow_positive(abs0, y);
+#	else
+		glm_vec4 const pow0 = glm_vec4_exp(_mm_mul_ps(y, glm_vec4_log(abs0)));
+#	endif
+
+	// Floats of magnitude 2^24 and above are all even integers
+	glm_ivec4 const rnd0 = _mm_cvtps_epi32(y);
+	glm_vec4 const big0 = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_set1_ps(16777216.0f));
+	glm_vec4 const int0 = _mm_or_ps(_mm_cmpeq_ps(_mm_cvtepi32_ps(rnd0), y), big0);
+	glm_vec4 const odd0 = _mm_andnot_ps(big0, _mm_castsi128_ps(_mm_slli_epi32(rnd0, 31)));
+	glm_vec4 const neg0 = _mm_cmplt_ps(x, _mm_setzero_ps());
+
+	// The sign of x, -0 included, carries over for odd integer y
+	glm_vec4 const sgn0 = _mm_and_ps(_mm_and_ps(x, int0), odd0);
+	glm_vec4 const pow1 = glm_vec4_select(_mm_andnot_ps(int0, neg0), _mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), _mm_xor_ps(pow0, sgn0));
+
+	// 1 for y = 0, x = 1 and |x| = 1 with infinite y, even where the other operand is NaN
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const abs1 = _mm_cmpeq_ps(abs0, one0);
+	glm_vec4 const infy = _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)));
+	glm_vec4 unit0 = _mm_or_ps(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_cmpeq_ps(x, one0));
+	unit0 = _mm_or_ps(unit0, _mm_and_ps(abs1, infy));
+	return glm_vec4_select(unit0, one0, pow1);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
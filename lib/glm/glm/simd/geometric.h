@@ -121,4 +121,55 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+// Double precision kernels. These keep the exact sqrt and division of the
+// scalar code: the rsqrt estimates above are only available for floats.
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_dot(glm_dvec2 v1, glm_dvec2 v2)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_dp_pd(v1, v2, 0x33);
+#	else
+		glm_dvec2 const mul0 = _mm_mul_pd(v1, v2);
+		glm_dvec2 const swp0 = _mm_shuffle_pd(mul0, mul0, 1);
+		glm_dvec2 const add0 = _mm_add_pd(mul0, swp0);
+		return add0;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_normalize(glm_dvec2 v)
+{
+	glm_dvec2 const dot0 = glm_dvec2_dot(v, v);
+	glm_dvec2 const isr0 = _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(dot0));
+	glm_dvec2 const mul0 = _mm_mul_pd(v, isr0);
+	return mul0;
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// (x * x' + y * y') + (z * z' + w * w') in every lane, summed in the same order as the scalar dot
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	glm_dvec4 const swp0 = _mm256_permute_pd(mul0, 0x5);
+	glm_dvec4 const add0 = _mm256_add_pd(mul0, swp0);
+	glm_dvec4 const swp1 = _mm256_permute2f128_pd(add0, add0, 0x01);
+	glm_dvec4 const add1 = _mm256_add_pd(add0, swp1);
+	return add1;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_length(glm_dvec4 x)
+{
+	glm_dvec4 const dot0 = glm_dvec4_dot(x, x);
+	glm_dvec4 const sqt0 = _mm256_sqrt_pd(dot0);
+	return sqt0;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_normalize(glm_dvec4 v)
+{
+	glm_dvec4 const dot0 = glm_dvec4_dot(v, v);
+	glm_dvec4 const isr0 = _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(dot0));
+	glm_dvec4 const mul0 = _mm256_mul_pd(v, isr0);
+	return mul0;
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1025,4 +1025,188 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// One double column per 256 bit register, (m[0] * v.x + m[1] * v.y) + (m[2] * v.z + m[3] * v.w)
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 const xyxy = _mm256_permute2f128_pd(v, v, 0x00);
+	glm_dvec4 const zwzw = _mm256_permute2f128_pd(v, v, 0x11);
+	glm_dvec4 const v0 = _mm256_permute_pd(xyxy, 0x0);
+	glm_dvec4 const v1 = _mm256_permute_pd(xyxy, 0xF);
+	glm_dvec4 const v2 = _mm256_permute_pd(zwzw, 0x0);
+	glm_dvec4 const v3 = _mm256_permute_pd(zwzw, 0xF);
+
+	glm_dvec4 const a0 = glm_dvec4_fma(m[1], v1, _mm256_mul_pd(m[0], v0));
+	glm_dvec4 const a1 = glm_dvec4_fma(m[3], v3, _mm256_mul_pd(m[2], v2));
+	return _mm256_add_pd(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const Col0 = glm_dmat4_mul_dvec4(in1, in2[0]);
+	glm_dvec4 const Col1 = glm_dmat4_mul_dvec4(in1, in2[1]);
+	glm_dvec4 const Col2 = glm_dmat4_mul_dvec4(in1, in2[2]);
+	glm_dvec4 const Col3 = glm_dmat4_mul_dvec4(in1, in2[3]);
+	out[0] = Col0;
+	out[1] = Col1;
+	out[2] = Col2;
+	out[3] = Col3;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// Two columns per 256 bit register: out[j], out[j + 1] = in1 * in2[j], in1 * in2[j + 1]
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx2(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m256 const a0 = _mm256_broadcast_ps(&in1[0]);
+	__m256 const a1 = _mm256_broadcast_ps(&in1[1]);
+	__m256 const a2 = _mm256_broadcast_ps(&in1[2]);
+	__m256 const a3 = _mm256_broadcast_ps(&in1[3]);
+	__m256 const b01 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 const b23 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+
+	__m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, _MM_SHUFFLE(0, 0, 0, 0)));
+	r01 = glm_vec8_fma(a1, _mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1)), r01);
+	r23 = glm_vec8_fma(a1, _mm256_permute_ps(b23, _MM_SHUFFLE(1, 1, 1, 1)), r23);
+	r01 = glm_vec8_fma(a2, _mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2)), r01);
+	r23 = glm_vec8_fma(a2, _mm256_permute_ps(b23, _MM_SHUFFLE(2, 2, 2, 2)), r23);
+	r01 = glm_vec8_fma(a3, _mm256_permute_ps(b01, _MM_SHUFFLE(3, 3, 3, 3)), r01);
+	r23 = glm_vec8_fma(a3, _mm256_permute_ps(b23, _MM_SHUFFLE(3, 3, 3, 3)), r23);
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), r01);
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), r23);
+}
+
+// Two cofactor vectors of the inverse at once, Fac(a0, b0) in the low and Fac(a1, b1) in the high half:
+//	Fac(a, b) = (m[2][a] * m[3][b] - m[3][a] * m[2][b], same, m[1][a] * m[3][b] - m[3][a] * m[1][b], m[1][a] * m[2][b] - m[2][a] * m[1][b])
+// s12 holds columns 1 and 2, s23 columns 2 and 3.
+GLM_FUNC_QUALIFIER __m256 glm_mat4_cofactor2_avx2(__m256 s12, __m256 s23, int a0, int b0, int a1, int b1)
+{
+	__m256 const w0 = _mm256_permutevar8x32_ps(s12, _mm256_setr_epi32(4 + a0, 4 + a0, a0, a0, 4 + a1, 4 + a1, a1, a1));
+	__m256 const w1 = _mm256_permutevar8x32_ps(s23, _mm256_setr_epi32(4 + b0, 4 + b0, 4 + b0, b0, 4 + b1, 4 + b1, 4 + b1, b1));
+	__m256 const w2 = _mm256_permutevar8x32_ps(s23, _mm256_setr_epi32(4 + a0, 4 + a0, 4 + a0, a0, 4 + a1, 4 + a1, 4 + a1, a1));
+	__m256 const w3 = _mm256_permutevar8x32_ps(s12, _mm256_setr_epi32(4 + b0, 4 + b0, b0, b0, 4 + b1, 4 + b1, b1, b1));
+	return glm_vec8_fms(w0, w1, _mm256_mul_ps(w2, w3));
+}
+
+// Same cofactor expansion as glm_mat4_inverse, with the six cofactor vectors and
+// the four columns of the adjugate computed two at a time.
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_avx2(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m256 const s01 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[0]));
+	__m256 const s12 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[1]));
+	__m256 const s23 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[2]));
+
+	__m256 const Fac01 = glm_mat4_cofactor2_avx2(s12, s23, 2, 3, 1, 3);
+	__m256 const Fac23 = glm_mat4_cofactor2_avx2(s12, s23, 1, 2, 0, 3);
+	__m256 const Fac45 = glm_mat4_cofactor2_avx2(s12, s23, 0, 2, 0, 1);
+
+	// Vec0 = (m[1][0], m[0][0], m[0][0], m[0][0]), Vec1, Vec2 and Vec3 the same for the other rows
+	__m256 const Vec10 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(5, 1, 1, 1, 4, 0, 0, 0));
+	__m256 const Vec22 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(6, 2, 2, 2, 6, 2, 2, 2));
+	__m256 const Vec33 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(7, 3, 3, 3, 7, 3, 3, 3));
+	__m256 const Vec00 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(4, 0, 0, 0, 4, 0, 0, 0));
+	__m256 const Vec11 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(5, 1, 1, 1, 5, 1, 1, 1));
+	__m256 const Vec32 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(7, 3, 3, 3, 6, 2, 2, 2));
+
+	// Inv0 = Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2
+	// Inv1 = Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4
+	// Inv2 = Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5
+	// Inv3 = Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5
+	__m256 Inv01 = glm_vec8_fms(Vec10, _mm256_permute2f128_ps(Fac01, Fac01, 0x00), _mm256_mul_ps(Vec22, _mm256_permute2f128_ps(Fac01, Fac23, 0x31)));
+	Inv01 = glm_vec8_fma(Vec33, _mm256_permute2f128_ps(Fac23, Fac45, 0x20), Inv01);
+	__m256 Inv23 = glm_vec8_fms(Vec00, _mm256_permute2f128_ps(Fac01, Fac23, 0x21), _mm256_mul_ps(Vec11, _mm256_permute2f128_ps(Fac23, Fac45, 0x21)));
+	Inv23 = glm_vec8_fma(Vec32, _mm256_permute2f128_ps(Fac45, Fac45, 0x11), Inv23);
+
+	// SignA for the even columns, SignB for the odd ones
+	__m256 const Sign = _mm256_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+	Inv01 = _mm256_mul_ps(Inv01, Sign);
+	Inv23 = _mm256_mul_ps(Inv23, Sign);
+
+	// Determinant: dot of the first column with the first row of the adjugate
+	__m256 const Row01 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+	__m256 const Row23 = _mm256_permutevar8x32_ps(s01, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3));
+	__m256 const Dot = glm_vec8_fma(Inv23, Row23, _mm256_mul_ps(Inv01, Row01));
+	__m128 const Det = _mm_add_ps(_mm256_castps256_ps128(Dot), _mm256_extractf128_ps(Dot, 1));
+	__m256 const Rcp = _mm256_broadcastss_ps(_mm_div_ss(_mm_set_ss(1.0f), Det));
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_mul_ps(Inv01, Rcp));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_mul_ps(Inv23, Rcp));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+// The whole matrix in one 512 bit register, column j in 128 bit lane j
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx512(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m512 const b = _mm512_loadu_ps(reinterpret_cast<float const*>(in2));
+
+	__m512 r = _mm512_mul_ps(_mm512_broadcast_f32x4(in1[0]), _mm512_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+	r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(in1[1]), _mm512_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), r);
+	r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(in1[2]), _mm512_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)), r);
+	r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(in1[3]), _mm512_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), r);
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), r);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512i const Index = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_permutexvar_ps(Index, _mm512_loadu_ps(reinterpret_cast<float const*>(in))));
+}
+
+// Cofactor vector Fac(a, b) of glm_mat4_cofactor2_avx2 for the four lanes (a0, b0) to (a3, b3)
+GLM_FUNC_QUALIFIER __m512 glm_mat4_cofactor4_avx512(__m512 m, int a0, int b0, int a1, int b1, int a2, int b2, int a3, int b3)
+{
+	__m512 const w0 = _mm512_permutexvar_ps(_mm512_setr_epi32(
+		8 + a0, 8 + a0, 4 + a0, 4 + a0, 8 + a1, 8 + a1, 4 + a1, 4 + a1, 8 + a2, 8 + a2, 4 + a2, 4 + a2, 8 + a3, 8 + a3, 4 + a3, 4 + a3), m);
+	__m512 const w1 = _mm512_permutexvar_ps(_mm512_setr_epi32(
+		12 + b0, 12 + b0, 12 + b0, 8 + b0, 12 + b1, 12 + b1, 12 + b1, 8 + b1, 12 + b2, 12 + b2, 12 + b2, 8 + b2, 12 + b3, 12 + b3, 12 + b3, 8 + b3), m);
+	__m512 const w2 = _mm512_permutexvar_ps(_mm512_setr_epi32(
+		12 + a0, 12 + a0, 12 + a0, 8 + a0, 12 + a1, 12 + a1, 12 + a1, 8 + a1, 12 + a2, 12 + a2, 12 + a2, 8 + a2, 12 + a3, 12 + a3, 12 + a3, 8 + a3), m);
+	__m512 const w3 = _mm512_permutexvar_ps(_mm512_setr_epi32(
+		8 + b0, 8 + b0, 4 + b0, 4 + b0, 8 + b1, 8 + b1, 4 + b1, 4 + b1, 8 + b2, 8 + b2, 4 + b2, 4 + b2, 8 + b3, 8 + b3, 4 + b3, 4 + b3), m);
+	return _mm512_fmsub_ps(w0, w1, _mm512_mul_ps(w2, w3));
+}
+
+// All four columns of the adjugate in one register
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+
+	__m512 const Fac0123 = glm_mat4_cofactor4_avx512(m, 2, 3, 1, 3, 1, 2, 0, 3);
+	__m512 const Fac4545 = glm_mat4_cofactor4_avx512(m, 0, 2, 0, 1, 0, 2, 0, 1);
+
+	// Inv = VecA * FacA - VecB * FacB + VecC * FacC, one column per lane
+	__m512 const VecA = _mm512_permutexvar_ps(_mm512_setr_epi32(5, 1, 1, 1, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0), m);
+	__m512 const VecB = _mm512_permutexvar_ps(_mm512_setr_epi32(6, 2, 2, 2, 6, 2, 2, 2, 5, 1, 1, 1, 5, 1, 1, 1), m);
+	__m512 const VecC = _mm512_permutexvar_ps(_mm512_setr_epi32(7, 3, 3, 3, 7, 3, 3, 3, 7, 3, 3, 3, 6, 2, 2, 2), m);
+	// Fac0 Fac0 Fac1 Fac2, Fac1 Fac3 Fac3 Fac4, Fac2 Fac4 Fac5 Fac5; indices 16 and up select from Fac4545
+	__m512 const FacA = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11), Fac0123);
+	__m512 const FacB = _mm512_permutex2var_ps(Fac0123, _mm512_setr_epi32(4, 5, 6, 7, 12, 13, 14, 15, 12, 13, 14, 15, 16, 17, 18, 19), Fac4545);
+	__m512 const FacC = _mm512_permutex2var_ps(Fac0123, _mm512_setr_epi32(8, 9, 10, 11, 16, 17, 18, 19, 20, 21, 22, 23, 20, 21, 22, 23), Fac4545);
+
+	__m512 const Sign = _mm512_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+	__m512 Inv = _mm512_fmsub_ps(VecA, FacA, _mm512_mul_ps(VecB, FacB));
+	Inv = _mm512_mul_ps(_mm512_fmadd_ps(VecC, FacC, Inv), Sign);
+
+	// Determinant: lanes 0, 4, 8 and 12 of Inv times the first column, summed across the 128 bit lanes
+	__m512 const Row = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3), m);
+	__m512 const Dot = _mm512_mul_ps(Inv, Row);
+	__m256 const Dot8 = _mm256_add_ps(_mm512_castps512_ps256(Dot), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(Dot), 1)));
+	__m128 const Det = _mm_add_ps(_mm256_castps256_ps128(Dot8), _mm256_extractf128_ps(Dot8, 1));
+	// one division, a full width one costs several times more
+	__m512 const Rcp = _mm512_broadcastss_ps(_mm_div_ss(_mm_set_ss(1.0f), Det));
+
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_mul_ps(Inv, Rcp));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
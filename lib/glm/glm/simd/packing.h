@@ -3,6 +3,235 @@
 
 #pragma once
 
+#include "platform.h"
+
+#include <cstddef>
+#include <cstring>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Bulk conversions between float arrays and half or normalized integer arrays.
+// Each kernel converts a fixed block; the last partial block goes through a
+// zero padded copy so every element takes the same path.
+
+// F16C came with every AVX2 CPU, but GCC and Clang only enable it with -mf16c
+// or a -march that has it. AVX-512F has its own 16 wide conversions.
+#if defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#	define GLM_SIMD_F16C 1
+#else
+#	define GLM_SIMD_F16C 0
+#endif
+
+template<std::size_t Block, typename inType, typename outType>
+GLM_FUNC_QUALIFIER void glm_packing_batch(inType const* in, outType* out, std::size_t count, void (*kernel)(inType const*, outType*))
+{
+	std::size_t i = 0;
+	for(; i + Block <= count; i += Block)
+		kernel(in + i, out + i);
+	if(i < count)
+	{
+		inType In[Block];
+		outType Out[Block];
+		std::memset(In, 0, sizeof(In));
+		std::memcpy(In, in + i, (count - i) * sizeof(inType));
+		kernel(In, Out);
+		std::memcpy(out + i, Out, (count - i) * sizeof(outType));
+	}
+}
+
+// IEEE half of each lane, rounded to nearest even, in the low 16 bits of
+// each 32 bit lane, sign extended so _mm_packs_epi32 keeps it. NaNs become
+// the quiet NaN 0x7e00.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half(glm_vec4 f)
+{
+	glm_ivec4 const MinNormal = _mm_set1_epi32((127 - 14) << 23);
+	glm_ivec4 const Max = _mm_set1_epi32((127 + 16) << 23);
+	glm_ivec4 const SubnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+	glm_vec4 const Sign = _mm_and_ps(f, _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u))));
+	glm_vec4 const Abs = _mm_xor_ps(f, Sign);
+	glm_ivec4 const AbsBits = _mm_castps_si128(Abs);
+
+	// halves below the smallest normal: let the float add round the mantissa
+	glm_ivec4 const Subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(SubnormalMagic))), SubnormalMagic);
+
+	// normal halves: rebias the exponent, add half an ulp minus one, plus one if the result is odd
+	glm_ivec4 const Odd = _mm_srai_epi32(_mm_slli_epi32(AbsBits, 31 - 13), 31);
+	glm_ivec4 const Normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(AbsBits, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), Odd), 13);
+
+	// infinity for overflows, with a mantissa bit for NaNs
+	glm_ivec4 const NaN = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(Abs, Abs)), _mm_set1_epi32(0x200));
+	glm_ivec4 const Special = _mm_or_si128(NaN, _mm_set1_epi32(0x7c00));
+
+	glm_ivec4 const IsSubnormal = _mm_cmpgt_epi32(MinNormal, AbsBits);
+	glm_ivec4 const IsRegular = _mm_cmpgt_epi32(Max, AbsBits);
+	glm_ivec4 const Finite = _mm_or_si128(_mm_and_si128(IsSubnormal, Subnormal), _mm_andnot_si128(IsSubnormal, Normal));
+	glm_ivec4 const Result = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, Special));
+	return _mm_or_si128(Result, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+}
+
+// float of the half in the low 16 bits of each lane, exact
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_half(glm_ivec4 h)
+{
+	glm_ivec4 const Abs = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+	glm_ivec4 const Sign = _mm_slli_epi32(_mm_xor_si128(h, Abs), 16);
+
+	// the half exponent and mantissa moved into a float, scaled by 2^112 to
+	// rebias; subnormal halves come out right as float subnormals
+	glm_vec4 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(Abs, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+	glm_ivec4 const InfNaN = _mm_and_si128(_mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+	return _mm_or_ps(Scaled, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaN)));
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	GLM_FUNC_QUALIFIER void glm_half_pack_block(float const* in, unsigned short* out)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtps_ph(_mm512_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT));
+	}
+
+	GLM_FUNC_QUALIFIER void glm_half_unpack_block(unsigned short const* in, float* out)
+	{
+		_mm512_storeu_ps(out, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(in))));
+	}
+
+	static std::size_t const glm_half_block = 16;
+#elif GLM_SIMD_F16C
+	GLM_FUNC_QUALIFIER void glm_half_pack_block(float const* in, unsigned short* out)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_cvtps_ph(_mm256_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT));
+	}
+
+	GLM_FUNC_QUALIFIER void glm_half_unpack_block(unsigned short const* in, float* out)
+	{
+		_mm256_storeu_ps(out, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in))));
+	}
+
+	static std::size_t const glm_half_block = 8;
+#else
+	GLM_FUNC_QUALIFIER void glm_half_pack_block(float const* in, unsigned short* out)
+	{
+		glm_ivec4 const a = glm_vec4_to_half(_mm_loadu_ps(in + 0));
+		glm_ivec4 const b = glm_vec4_to_half(_mm_loadu_ps(in + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(a, b));
+	}
+
+	GLM_FUNC_QUALIFIER void glm_half_unpack_block(unsigned short const* in, float* out)
+	{
+		glm_ivec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in));
+		_mm_storeu_ps(out + 0, glm_vec4_from_half(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+		_mm_storeu_ps(out + 4, glm_vec4_from_half(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+	}
+
+	static std::size_t const glm_half_block = 8;
+#endif
+
+// out[i] = half(in[i]) rounded to nearest even, for count floats
+GLM_FUNC_QUALIFIER void glm_half_pack_batch(float const* in, unsigned short* out, std::size_t count)
+{
+	glm_packing_batch<glm_half_block>(in, out, count, glm_half_pack_block);
+}
+
+// out[i] = float(in[i]), for count halves
+GLM_FUNC_QUALIFIER void glm_half_unpack_batch(unsigned short const* in, float* out, std::size_t count)
+{
+	glm_packing_batch<glm_half_block>(in, out, count, glm_half_unpack_block);
+}
+
+// round half away from zero like std::round, for |v| < 2^23
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_int(glm_vec4 v)
+{
+	glm_ivec4 const Trunc = _mm_cvttps_epi32(v);
+	glm_vec4 const Fract = _mm_sub_ps(v, _mm_cvtepi32_ps(Trunc));
+	glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(Fract, _mm_set1_ps(0.5f)));
+	glm_ivec4 const Down = _mm_castps_si128(_mm_cmple_ps(Fract, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(Trunc, Up), Down);
+}
+
+// round(clamp(in[k], Min, 1) * Scale) for four floats, as packUnorm and packSnorm
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_norm(float const* in, float Min, float Scale)
+{
+	glm_vec4 const v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in), _mm_set1_ps(Min)), _mm_set1_ps(1.0f));
+	return glm_vec4_round_int(_mm_mul_ps(v, _mm_set1_ps(Scale)));
+}
+
+GLM_FUNC_QUALIFIER void glm_unorm8_pack_block(float const* in, unsigned char* out)
+{
+	glm_ivec4 const Low = _mm_packs_epi32(glm_vec4_pack_norm(in + 0, 0.0f, 255.0f), glm_vec4_pack_norm(in + 4, 0.0f, 255.0f));
+	glm_ivec4 const High = _mm_packs_epi32(glm_vec4_pack_norm(in + 8, 0.0f, 255.0f), glm_vec4_pack_norm(in + 12, 0.0f, 255.0f));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(Low, High));
+}
+
+GLM_FUNC_QUALIFIER void glm_snorm8_pack_block(float const* in, signed char* out)
+{
+	glm_ivec4 const Low = _mm_packs_epi32(glm_vec4_pack_norm(in + 0, -1.0f, 127.0f), glm_vec4_pack_norm(in + 4, -1.0f, 127.0f));
+	glm_ivec4 const High = _mm_packs_epi32(glm_vec4_pack_norm(in + 8, -1.0f, 127.0f), glm_vec4_pack_norm(in + 12, -1.0f, 127.0f));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packs_epi16(Low, High));
+}
+
+GLM_FUNC_QUALIFIER void glm_unorm16_pack_block(float const* in, unsigned short* out)
+{
+	glm_ivec4 const a = glm_vec4_pack_norm(in + 0, 0.0f, 65535.0f);
+	glm_ivec4 const b = glm_vec4_pack_norm(in + 4, 0.0f, 65535.0f);
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(a, b));
+#	else
+		// no unsigned saturation before SSE4.1: pack as signed around 32768
+		glm_ivec4 const Bias = _mm_set1_epi32(32768);
+		glm_ivec4 const Packed = _mm_packs_epi32(_mm_sub_epi32(a, Bias), _mm_sub_epi32(b, Bias));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_xor_si128(Packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_snorm16_pack_block(float const* in, short* out)
+{
+	glm_ivec4 const a = glm_vec4_pack_norm(in + 0, -1.0f, 32767.0f);
+	glm_ivec4 const b = glm_vec4_pack_norm(in + 4, -1.0f, 32767.0f);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(a, b));
+}
+
+// float(in[k]) * Scale for four 32 bit integers, clamped to [-1, 1] for snorm
+GLM_FUNC_QUALIFIER void glm_vec4_unpack_norm(glm_ivec4 i, float Scale, bool Signed, float* out)
+{
+	glm_vec4 const v = _mm_mul_ps(_mm_cvtepi32_ps(i), _mm_set1_ps(Scale));
+	_mm_storeu_ps(out, Signed ? _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)) : v);
+}
+
+GLM_FUNC_QUALIFIER void glm_unorm8_unpack_block(unsigned char const* in, float* out)
+{
+	glm_ivec4 const Zero = _mm_setzero_si128();
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in));
+	glm_ivec4 const Low = _mm_unpacklo_epi8(p, Zero);
+	glm_ivec4 const High = _mm_unpackhi_epi8(p, Zero);
+	glm_vec4_unpack_norm(_mm_unpacklo_epi16(Low, Zero), 1.0f / 255.0f, false, out + 0);
+	glm_vec4_unpack_norm(_mm_unpackhi_epi16(Low, Zero), 1.0f / 255.0f, false, out + 4);
+	glm_vec4_unpack_norm(_mm_unpacklo_epi16(High, Zero), 1.0f / 255.0f, false, out + 8);
+	glm_vec4_unpack_norm(_mm_unpackhi_epi16(High, Zero), 1.0f / 255.0f, false, out + 12);
+}
+
+GLM_FUNC_QUALIFIER void glm_snorm8_unpack_block(signed char const* in, float* out)
+{
+	// sign extension: each byte to the top of a wider lane, then an arithmetic shift
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in));
+	glm_ivec4 const Low = _mm_unpacklo_epi8(p, p);
+	glm_ivec4 const High = _mm_unpackhi_epi8(p, p);
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpacklo_epi16(Low, Low), 24), 1.0f / 127.0f, true, out + 0);
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpackhi_epi16(Low, Low), 24), 1.0f / 127.0f, true, out + 4);
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpacklo_epi16(High, High), 24), 1.0f / 127.0f, true, out + 8);
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpackhi_epi16(High, High), 24), 1.0f / 127.0f, true, out + 12);
+}
+
+GLM_FUNC_QUALIFIER void glm_unorm16_unpack_block(unsigned short const* in, float* out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in));
+	glm_vec4_unpack_norm(_mm_unpacklo_epi16(p, _mm_setzero_si128()), 1.0f / 65535.0f, false, out + 0);
+	glm_vec4_unpack_norm(_mm_unpackhi_epi16(p, _mm_setzero_si128()), 1.0f / 65535.0f, false, out + 4);
+}
+
+GLM_FUNC_QUALIFIER void glm_snorm16_unpack_block(short const* in, float* out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in));
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16), 1.0f / 32767.0f, true, out + 0);
+	glm_vec4_unpack_norm(_mm_srai_epi32(_mm_unpackhi_epi16(p, p), 16), 1.0f / 32767.0f, true, out + 4);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
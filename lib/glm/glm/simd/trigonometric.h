@@ -3,7 +3,190 @@
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Polynomial sine, cosine and arc tangent, after the Cephes library. The
+// argument is reduced to [-pi/4, pi/4] from its octant, with pi/4 split in
+// three parts so the reduction stays exact for |x| <= 8192 in single
+// precision and |x| <= 2^30 in double precision. Larger arguments lose
+// accuracy progressively.
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn0 = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+
+	// Octant of |x|, rounded up to even: j = (int(|x| * 4 / pi) + 1) & ~1
+	glm_ivec4 j = _mm_cvttps_epi32(_mm_mul_ps(abs0, _mm_set1_ps(1.27323954473516f)));
+	j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_vec4 const y = _mm_cvtepi32_ps(j);
+
+	// Bit 2 of j flips the sine, bit 2 of j - 2 the cosine, bit 1 swaps the polynomials
+	glm_vec4 const sfl0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+	glm_vec4 const cfl0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	glm_vec4 const swp0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	// z = |x| - y * pi / 4
+	glm_vec4 const neg0 = _mm_sub_ps(_mm_setzero_ps(), y);
+	glm_vec4 z = glm_vec4_fma(neg0, _mm_set1_ps(0.78515625f), abs0);
+	z = glm_vec4_fma(neg0, _mm_set1_ps(2.4187564849853515625e-4f), z);
+	z = glm_vec4_fma(neg0, _mm_set1_ps(3.77489497744594108e-8f), z);
+	glm_vec4 const zz = _mm_mul_ps(z, z);
+
+	glm_vec4 cos0 = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), zz, _mm_set1_ps(-1.388731625493765e-3f));
+	cos0 = glm_vec4_fma(cos0, zz, _mm_set1_ps(4.166664568298827e-2f));
+	cos0 = _mm_mul_ps(_mm_mul_ps(cos0, zz), zz);
+	cos0 = glm_vec4_fma(zz, _mm_set1_ps(-0.5f), cos0);
+	cos0 = _mm_add_ps(cos0, _mm_set1_ps(1.0f));
+
+	glm_vec4 sin0 = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), zz, _mm_set1_ps(8.3321608736e-3f));
+	sin0 = glm_vec4_fma(sin0, zz, _mm_set1_ps(-1.6666654611e-1f));
+	sin0 = glm_vec4_fma(_mm_mul_ps(sin0, zz), z, z);
+
+	*s = _mm_xor_ps(glm_vec4_select(swp0, sin0, cos0), _mm_xor_ps(sgn0, sfl0));
+	*c = _mm_xor_ps(glm_vec4_select(swp0, cos0, sin0), cfl0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+// atan2(y, x) from atan(min(|x|, |y|) / max(|x|, |y|)) on [0, 1] and the quadrant
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const absx = glm_vec4_abs(x);
+	glm_vec4 const absy = glm_vec4_abs(y);
+	glm_vec4 const min0 = _mm_min_ps(absx, absy);
+	glm_vec4 const max0 = _mm_max_ps(absx, absy);
+	glm_vec4 const zro0 = _mm_cmpeq_ps(max0, _mm_setzero_ps());
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+
+	// Both infinite: the ratio is taken as 1, giving odd multiples of pi / 4
+	glm_vec4 const inf0 = _mm_cmpeq_ps(min0, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)));
+	glm_vec4 const t = glm_vec4_select(inf0, one0, _mm_andnot_ps(zro0, _mm_div_ps(min0, max0)));
+
+	// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) above tan(pi / 8)
+	glm_vec4 const big0 = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+	glm_vec4 const u = glm_vec4_select(big0, _mm_div_ps(_mm_sub_ps(t, one0), _mm_add_ps(t, one0)), t);
+	glm_vec4 const uu = _mm_mul_ps(u, u);
+
+	glm_vec4 poly = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), uu, _mm_set1_ps(-1.38776856032e-1f));
+	poly = glm_vec4_fma(poly, uu, _mm_set1_ps(1.99777106478e-1f));
+	poly = glm_vec4_fma(poly, uu, _mm_set1_ps(-3.33329491539e-1f));
+	glm_vec4 r = glm_vec4_fma(_mm_mul_ps(poly, uu), u, u);
+	r = _mm_add_ps(r, _mm_and_ps(big0, _mm_set1_ps(0.78539816339744830962f)));
+
+	r = glm_vec4_select(_mm_cmpgt_ps(absy, absx), _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), r), r);
+	glm_vec4 const neg0 = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+	r = glm_vec4_select(neg0, _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), r), r);
+	r = _mm_xor_ps(r, _mm_and_ps(y, _mm_set1_ps(-0.0f)));
+	return glm_vec4_select(_mm_cmpunord_ps(x, y), _mm_add_ps(x, y), r);
+}
 
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER void glm_dvec4_sincos(glm_dvec4 x, glm_dvec4* s, glm_dvec4* c)
+{
+	glm_dvec4 const sgn0 = _mm256_and_pd(x, _mm256_set1_pd(-0.0));
+	glm_dvec4 const abs0 = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+
+	__m128i j = _mm256_cvttpd_epi32(_mm256_mul_pd(abs0, _mm256_set1_pd(1.27323954473516268615)));
+	j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_dvec4 const y = _mm256_cvtepi32_pd(j);
+
+	__m256i const j64 = _mm256_cvtepi32_epi64(j);
+	glm_dvec4 const sfl0 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(j64, _mm256_set1_epi64x(4)), 61));
+	glm_dvec4 const cfl0 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_andnot_si256(_mm256_sub_epi64(j64, _mm256_set1_epi64x(2)), _mm256_set1_epi64x(4)), 61));
+	glm_dvec4 const swp0 = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(j64, _mm256_set1_epi64x(2)), _mm256_setzero_si256()));
+
+	glm_dvec4 const neg0 = _mm256_sub_pd(_mm256_setzero_pd(), y);
+	glm_dvec4 z = glm_dvec4_fma(neg0, _mm256_set1_pd(7.85398125648498535156e-1), abs0);
+	z = glm_dvec4_fma(neg0, _mm256_set1_pd(3.77489470793079817668e-8), z);
+	z = glm_dvec4_fma(neg0, _mm256_set1_pd(2.69515142907905952645e-15), z);
+	glm_dvec4 const zz = _mm256_mul_pd(z, z);
+
+	glm_dvec4 cos0 = glm_dvec4_fma(_mm256_set1_pd(-1.13585365213876817300e-11), zz, _mm256_set1_pd(2.08757008419747316778e-9));
+	cos0 = glm_dvec4_fma(cos0, zz, _mm256_set1_pd(-2.75573141792967388112e-7));
+	cos0 = glm_dvec4_fma(cos0, zz, _mm256_set1_pd(2.48015872888517045348e-5));
+	cos0 = glm_dvec4_fma(cos0, zz, _mm256_set1_pd(-1.38888888888730564116e-3));
+	cos0 = glm_dvec4_fma(cos0, zz, _mm256_set1_pd(4.16666666666665929218e-2));
+	cos0 = _mm256_mul_pd(_mm256_mul_pd(cos0, zz), zz);
+	cos0 = _mm256_add_pd(glm_dvec4_fma(zz, _mm256_set1_pd(-0.5), _mm256_set1_pd(1.0)), cos0);
+
+	glm_dvec4 sin0 = glm_dvec4_fma(_mm256_set1_pd(1.58962301576546568060e-10), zz, _mm256_set1_pd(-2.50507477628578072866e-8));
+	sin0 = glm_dvec4_fma(sin0, zz, _mm256_set1_pd(2.75573136213857245213e-6));
+	sin0 = glm_dvec4_fma(sin0, zz, _mm256_set1_pd(-1.98412698295895385996e-4));
+	sin0 = glm_dvec4_fma(sin0, zz, _mm256_set1_pd(8.33333333332211858878e-3));
+	sin0 = glm_dvec4_fma(sin0, zz, _mm256_set1_pd(-1.66666666666666307295e-1));
+	sin0 = glm_dvec4_fma(_mm256_mul_pd(sin0, zz), z, z);
+
+	// The reduction keeps infinities, which have to give NaN like NaN inputs
+	glm_dvec4 const nan0 = _mm256_cmp_pd(abs0, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL)), _CMP_NLT_UQ);
+	*s = _mm256_or_pd(_mm256_xor_pd(glm_dvec4_select(swp0, sin0, cos0), _mm256_xor_pd(sgn0, sfl0)), nan0);
+	*c = _mm256_or_pd(_mm256_xor_pd(glm_dvec4_select(swp0, cos0, sin0), cfl0), nan0);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_sin(glm_dvec4 x)
+{
+	glm_dvec4 s, c;
+	glm_dvec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_cos(glm_dvec4 x)
+{
+	glm_dvec4 s, c;
+	glm_dvec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_atan2(glm_dvec4 y, glm_dvec4 x)
+{
+	glm_dvec4 const absx = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+	glm_dvec4 const absy = _mm256_andnot_pd(_mm256_set1_pd(-0.0), y);
+	glm_dvec4 const min0 = _mm256_min_pd(absx, absy);
+	glm_dvec4 const max0 = _mm256_max_pd(absx, absy);
+	glm_dvec4 const zro0 = _mm256_cmp_pd(max0, _mm256_setzero_pd(), _CMP_EQ_OQ);
+	glm_dvec4 const one0 = _mm256_set1_pd(1.0);
+
+	// Both infinite: the ratio is taken as 1, giving odd multiples of pi / 4
+	glm_dvec4 const inf0 = _mm256_cmp_pd(min0, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL)), _CMP_EQ_OQ);
+	glm_dvec4 const t = glm_dvec4_select(inf0, one0, _mm256_andnot_pd(zro0, _mm256_div_pd(min0, max0)));
+
+	// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) above 0.66
+	glm_dvec4 const big0 = _mm256_cmp_pd(t, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+	glm_dvec4 const u = glm_dvec4_select(big0, _mm256_div_pd(_mm256_sub_pd(t, one0), _mm256_add_pd(t, one0)), t);
+	glm_dvec4 const uu = _mm256_mul_pd(u, u);
+
+	glm_dvec4 p = glm_dvec4_fma(_mm256_set1_pd(-8.750608600031904122785e-1), uu, _mm256_set1_pd(-1.615753718733365076637e1));
+	p = glm_dvec4_fma(p, uu, _mm256_set1_pd(-7.500855792314704667340e1));
+	p = glm_dvec4_fma(p, uu, _mm256_set1_pd(-1.228866684490136173410e2));
+	p = glm_dvec4_fma(p, uu, _mm256_set1_pd(-6.485021904942025371773e1));
+	glm_dvec4 q = _mm256_add_pd(uu, _mm256_set1_pd(2.485846490142306297962e1));
+	q = glm_dvec4_fma(q, uu, _mm256_set1_pd(1.650270098316988542046e2));
+	q = glm_dvec4_fma(q, uu, _mm256_set1_pd(4.328810604912902668951e2));
+	q = glm_dvec4_fma(q, uu, _mm256_set1_pd(4.853903996359136964868e2));
+	q = glm_dvec4_fma(q, uu, _mm256_set1_pd(1.945506571482613964425e2));
+	glm_dvec4 r = glm_dvec4_fma(_mm256_div_pd(_mm256_mul_pd(p, uu), q), u, u);
+	r = _mm256_add_pd(r, _mm256_and_pd(big0, _mm256_set1_pd(0.78539816339744830962)));
+
+	r = glm_dvec4_select(_mm256_cmp_pd(absy, absx, _CMP_GT_OQ), _mm256_sub_pd(_mm256_set1_pd(1.57079632679489661923), r), r);
+	glm_dvec4 const neg0 = _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_castpd_si256(x)));
+	r = glm_dvec4_select(neg0, _mm256_sub_pd(_mm256_set1_pd(3.14159265358979323846), r), r);
+	r = _mm256_xor_pd(r, _mm256_and_pd(y, _mm256_set1_pd(-0.0)));
+	return glm_dvec4_select(_mm256_cmp_pd(x, y, _CMP_UNORD_Q), _mm256_add_pd(x, y), r);
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
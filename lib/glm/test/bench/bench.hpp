@@ -0,0 +1,250 @@
+#pragma once
+
+// Minimal benchmark harness for the glm benchmark programs.
+//
+// Each kernel runs over a batch of Ops elements that stays in cache. A run is
+// warmups, a calibration that picks how many batches make one repetition,
+// then Repetitions timed repetitions. Min, median and percentiles are over
+// the per-repetition ns/op; cycles/op is the median of the time stamp
+// counter, which ticks at the nominal frequency, not the boosted core clock.
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <x86intrin.h>
+#	define GLM_BENCH_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#	include <intrin.h>
+#	define GLM_BENCH_TSC 1
+#else
+#	define GLM_BENCH_TSC 0
+#endif
+
+namespace bench
+{
+	typedef std::chrono::steady_clock clock_type;
+
+	// std::allocator ignores the 32 byte alignment of the AVX types before C++17
+	template<typename T>
+	struct aligned_allocator
+	{
+		typedef T value_type;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef aligned_allocator<U> other;
+		};
+
+		aligned_allocator() {}
+		template<typename U>
+		aligned_allocator(aligned_allocator<U> const&) {}
+
+		T* allocate(std::size_t n)
+		{
+			std::size_t const Alignment = 64;
+			void* Raw = std::malloc(n * sizeof(T) + Alignment + sizeof(void*));
+			if(!Raw)
+				throw std::bad_alloc();
+			std::uintptr_t const Address = (reinterpret_cast<std::uintptr_t>(Raw) + sizeof(void*) + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1);
+			reinterpret_cast<void**>(Address)[-1] = Raw;
+			return reinterpret_cast<T*>(Address);
+		}
+
+		void deallocate(T* p, std::size_t)
+		{
+			std::free(reinterpret_cast<void**>(p)[-1]);
+		}
+
+		template<typename U>
+		bool operator==(aligned_allocator<U> const&) const { return true; }
+		template<typename U>
+		bool operator!=(aligned_allocator<U> const&) const { return false; }
+	};
+
+	template<typename T>
+	struct array
+	{
+		typedef std::vector<T, aligned_allocator<T> > type;
+	};
+
+	struct result
+	{
+		std::string Name;
+		std::size_t Ops;
+		int Repetitions;
+		double Min, P10, Median, P90, Max;
+		double Cycles;
+	};
+
+	struct options
+	{
+		int Warmups;
+		int Repetitions;
+		double RepetitionNs;
+		char const* Filter;
+	};
+
+	inline unsigned long long ticks()
+	{
+#		if GLM_BENCH_TSC
+			return __rdtsc();
+#		else
+			return 0;
+#		endif
+	}
+
+	// Nearest rank of the sorted samples
+	inline double percentile(std::vector<double> const& Sorted, double P)
+	{
+		std::size_t const Index = static_cast<std::size_t>(P * static_cast<double>(Sorted.size() - 1) + 0.5);
+		return Sorted[Index];
+	}
+
+	// ISA the build's glm kernels use, from GLM_ARCH
+	inline char const* arch_name()
+	{
+#		if GLM_CONFIG_SIMD == GLM_DISABLE
+			return "pure";
+#		elif GLM_ARCH & GLM_ARCH_AVX512_BIT
+			return "avx512";
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return "avx2";
+#		elif GLM_ARCH & GLM_ARCH_AVX_BIT
+			return "avx";
+#		elif GLM_ARCH & GLM_ARCH_SSE42_BIT
+			return "sse4.2";
+#		elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return "sse4.1";
+#		elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+			return "ssse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE3_BIT
+			return "sse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return "sse2";
+#		elif GLM_ARCH & GLM_ARCH_NEON_BIT
+			return "neon";
+#		else
+			return "pure";
+#		endif
+	}
+
+	class suite
+	{
+	public:
+		explicit suite(options const& Opts) :
+			Options(Opts),
+			Checksum(0)
+		{}
+
+		// Kernel() processes Ops elements and writes its results to the Bytes at Out,
+		// which are read back after every repetition so the work can't be optimized out
+		template<typename kernel>
+		void run(char const* Name, std::size_t Ops, kernel Kernel, void const* Out, std::size_t Bytes)
+		{
+			if(Options.Filter && !std::strstr(Name, Options.Filter))
+				return;
+
+			for(int i = 0; i < Options.Warmups; ++i)
+				Kernel();
+
+			clock_type::time_point const c0 = clock_type::now();
+			Kernel();
+			clock_type::time_point const c1 = clock_type::now();
+			double const Once = std::max(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(c1 - c0).count()), 1.0);
+			std::size_t const Batches = std::max<std::size_t>(1, static_cast<std::size_t>(Options.RepetitionNs / Once));
+			double const OpsPerRepetition = static_cast<double>(Batches * Ops);
+
+			std::vector<double> Ns(static_cast<std::size_t>(Options.Repetitions));
+			std::vector<double> Tsc(static_cast<std::size_t>(Options.Repetitions));
+			for(std::size_t r = 0; r < Ns.size(); ++r)
+			{
+				clock_type::time_point const t0 = clock_type::now();
+				unsigned long long const k0 = ticks();
+				for(std::size_t b = 0; b < Batches; ++b)
+					Kernel();
+				unsigned long long const k1 = ticks();
+				clock_type::time_point const t1 = clock_type::now();
+
+				Ns[r] = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / OpsPerRepetition;
+				Tsc[r] = static_cast<double>(k1 - k0) / OpsPerRepetition;
+				this->consume(Out, Bytes);
+			}
+
+			std::sort(Ns.begin(), Ns.end());
+			std::sort(Tsc.begin(), Tsc.end());
+
+			result Result;
+			Result.Name = Name;
+			Result.Ops = Batches * Ops;
+			Result.Repetitions = Options.Repetitions;
+			Result.Min = Ns.front();
+			Result.P10 = percentile(Ns, 0.1);
+			Result.Median = percentile(Ns, 0.5);
+			Result.P90 = percentile(Ns, 0.9);
+			Result.Max = Ns.back();
+			Result.Cycles = GLM_BENCH_TSC ? percentile(Tsc, 0.5) : -1.0;
+			Results.push_back(Result);
+		}
+
+		void print_table(std::FILE* File) const
+		{
+			std::fprintf(File, "%-32s %10s %10s %10s %10s\n", "benchmark", "ns/op", "p10", "p90", "cycles/op");
+			for(std::size_t i = 0; i < Results.size(); ++i)
+			{
+				result const& R = Results[i];
+				std::fprintf(File, "%-32s %10.3f %10.3f %10.3f %10.2f\n", R.Name.c_str(), R.Median, R.P10, R.P90, R.Cycles);
+			}
+		}
+
+		void print_json(std::FILE* File) const
+		{
+			std::fprintf(File, "{\n");
+			std::fprintf(File, "  \"glm_version\": %d,\n", GLM_VERSION);
+			std::fprintf(File, "  \"arch\": \"%s\",\n", arch_name());
+			std::fprintf(File, "  \"fast_math\": %s,\n", GLM_CONFIG_FAST_MATH == GLM_ENABLE ? "true" : "false");
+#			if defined(__VERSION__)
+				std::fprintf(File, "  \"compiler\": \"%s\",\n", __VERSION__);
+#			elif defined(_MSC_FULL_VER)
+				std::fprintf(File, "  \"compiler\": \"msvc %d\",\n", _MSC_FULL_VER);
+#			endif
+			std::fprintf(File, "  \"repetitions\": %d,\n", Options.Repetitions);
+			std::fprintf(File, "  \"results\": [\n");
+			for(std::size_t i = 0; i < Results.size(); ++i)
+			{
+				result const& R = Results[i];
+				std::fprintf(File, "    {\"name\": \"%s\", \"ops\": %lu, \"ns_per_op\": %.4f, \"min\": %.4f, \"p10\": %.4f, \"median\": %.4f, \"p90\": %.4f, \"max\": %.4f, ",
+					R.Name.c_str(), static_cast<unsigned long>(R.Ops), R.Median, R.Min, R.P10, R.Median, R.P90, R.Max);
+				if(R.Cycles < 0.0)
+					std::fprintf(File, "\"cycles_per_op\": null}");
+				else
+					std::fprintf(File, "\"cycles_per_op\": %.3f}", R.Cycles);
+				std::fprintf(File, i + 1 < Results.size() ? ",\n" : "\n");
+			}
+			std::fprintf(File, "  ],\n");
+			std::fprintf(File, "  \"checksum\": %u\n", Checksum);
+			std::fprintf(File, "}\n");
+		}
+
+	private:
+		void consume(void const* Out, std::size_t Bytes)
+		{
+			unsigned char const* Data = static_cast<unsigned char const*>(Out);
+			for(std::size_t i = 0; i < Bytes; ++i)
+				Checksum = Checksum * 31u + Data[i];
+		}
+
+		options const Options;
+		std::vector<result> Results;
+		unsigned int Checksum;
+	};
+}//namespace bench
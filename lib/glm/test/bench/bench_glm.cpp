@@ -0,0 +1,376 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "bench.hpp"
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#include <cstdlib>
+
+// The same source is built once per instruction set (see CMakeLists.txt), so
+// the JSON files of the bench-glm-* programs compare scalar, SSE and AVX code.
+// Results are printed as a table; --json also writes them to a file.
+//
+//   bench-glm-avx2 [--quick] [--json file] [--filter name]
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	static glm::qualifier const Q = glm::aligned_highp;
+#else
+	static glm::qualifier const Q = glm::highp;
+#endif
+
+typedef glm::vec<3, float, Q> vec3_type;
+typedef glm::vec<4, float, Q> vec4_type;
+typedef glm::mat<4, 4, float, Q> mat4_type;
+typedef glm::qua<float, Q> quat_type;
+typedef glm::vec<4, double, Q> dvec4_type;
+typedef glm::mat<4, 4, double, Q> dmat4_type;
+
+static std::size_t const Count = 1024;
+
+// Deterministic inputs in [Min, Max)
+static float uniform(unsigned int& Seed, float Min, float Max)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Min + (Max - Min) * static_cast<float>(Seed >> 8) / 16777216.0f;
+}
+
+static vec4_type random_vec4(unsigned int& Seed)
+{
+	return vec4_type(uniform(Seed, -1, 1), uniform(Seed, -1, 1), uniform(Seed, -1, 1), uniform(Seed, -1, 1));
+}
+
+static mat4_type random_mat4(unsigned int& Seed)
+{
+	glm::vec3 const Axis = glm::normalize(glm::vec3(uniform(Seed, 0.1f, 1), uniform(Seed, 0.1f, 1), uniform(Seed, 0.1f, 1)));
+	glm::mat4 const M = glm::mat4_cast(glm::angleAxis(uniform(Seed, 0, 3), Axis));
+	glm::vec4 const T(uniform(Seed, -5, 5), uniform(Seed, -5, 5), uniform(Seed, -5, 5), 1.0f);
+	return mat4_type(M[0] * uniform(Seed, 0.5f, 2), M[1] * uniform(Seed, 0.5f, 2), M[2] * uniform(Seed, 0.5f, 2), T);
+}
+
+static quat_type random_quat(unsigned int& Seed)
+{
+	glm::vec3 const Axis = glm::normalize(glm::vec3(uniform(Seed, 0.1f, 1), uniform(Seed, 0.1f, 1), uniform(Seed, 0.1f, 1)));
+	return quat_type(glm::angleAxis(uniform(Seed, -3, 3), Axis));
+}
+
+static void bench_vector(bench::suite& Suite)
+{
+	unsigned int Seed = 1;
+	bench::array<vec4_type>::type A(Count), B(Count), Out(Count);
+	bench::array<vec3_type>::type Out3(Count);
+	bench::array<float>::type Scalar(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = random_vec4(Seed);
+		B[i] = random_vec4(Seed);
+	}
+
+	Suite.run("vec4.add", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = A[i] + B[i]; }, &Out[0], Count * sizeof(vec4_type));
+	Suite.run("vec4.mul", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = A[i] * B[i]; }, &Out[0], Count * sizeof(vec4_type));
+	Suite.run("vec4.dot", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Scalar[i] = glm::dot(A[i], B[i]); }, &Scalar[0], Count * sizeof(float));
+	Suite.run("vec4.normalize", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::normalize(A[i]); }, &Out[0], Count * sizeof(vec4_type));
+	Suite.run("vec3.cross", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out3[i] = glm::cross(vec3_type(A[i]), vec3_type(B[i])); }, &Out3[0], Count * sizeof(vec3_type));
+
+	bench::array<dvec4_type>::type DA(Count), DB(Count), DOut(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		DA[i] = dvec4_type(A[i]);
+		DB[i] = dvec4_type(B[i]);
+	}
+
+	Suite.run("dvec4.add", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) DOut[i] = DA[i] + DB[i]; }, &DOut[0], Count * sizeof(dvec4_type));
+	Suite.run("dvec4.normalize", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) DOut[i] = glm::normalize(DA[i]); }, &DOut[0], Count * sizeof(dvec4_type));
+}
+
+static void bench_matrix(bench::suite& Suite)
+{
+	unsigned int Seed = 2;
+	bench::array<mat4_type>::type A(Count), B(Count), Out(Count);
+	bench::array<vec4_type>::type V(Count), OutV(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = random_mat4(Seed);
+		B[i] = random_mat4(Seed);
+		V[i] = random_vec4(Seed);
+	}
+
+	Suite.run("mat4.mul", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = A[i] * B[i]; }, &Out[0], Count * sizeof(mat4_type));
+	Suite.run("mat4.mul_vec4", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = A[i] * V[i]; }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("mat4.inverse", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::inverse(A[i]); }, &Out[0], Count * sizeof(mat4_type));
+	Suite.run("mat4.transpose", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::transpose(A[i]); }, &Out[0], Count * sizeof(mat4_type));
+
+	bench::array<dmat4_type>::type DA(Count), DB(Count), DOut(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		DA[i] = dmat4_type(A[i]);
+		DB[i] = dmat4_type(B[i]);
+	}
+
+	Suite.run("dmat4.mul", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) DOut[i] = DA[i] * DB[i]; }, &DOut[0], Count * sizeof(dmat4_type));
+}
+
+static void bench_quaternion(bench::suite& Suite)
+{
+	unsigned int Seed = 3;
+	bench::array<quat_type>::type A(Count), B(Count), Out(Count);
+	bench::array<vec4_type>::type V(Count), OutV(Count);
+	bench::array<mat4_type>::type OutM(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = random_quat(Seed);
+		B[i] = random_quat(Seed);
+		V[i] = random_vec4(Seed);
+	}
+
+	Suite.run("quat.mul", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = A[i] * B[i]; }, &Out[0], Count * sizeof(quat_type));
+	Suite.run("quat.rotate_vec4", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = A[i] * V[i]; }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("quat.slerp", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::slerp(A[i], B[i], 0.3f); }, &Out[0], Count * sizeof(quat_type));
+	Suite.run("quat.mat4_cast", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutM[i] = glm::mat4_cast(A[i]); }, &OutM[0], Count * sizeof(mat4_type));
+	Suite.run("quat.mul_batch", Count, [&]{ glm::mulBatch(&A[0], &B[0], &Out[0], Count); }, &Out[0], Count * sizeof(quat_type));
+	Suite.run("quat.slerp_batch", Count, [&]{ glm::slerpBatch(&A[0], &B[0], 0.3f, &Out[0], Count); }, &Out[0], Count * sizeof(quat_type));
+	Suite.run("quat.mat4_cast_batch", Count, [&]{ glm::mat4CastBatch(&A[0], &OutM[0], Count); }, &OutM[0], Count * sizeof(mat4_type));
+
+	// Four influences per vertex out of 64 joints, as in skinning
+	typedef glm::tdualquat<float, Q> dualquat_type;
+	bench::array<dualquat_type>::type Joints(64), OutD(Count);
+	bench::array<glm::vec<4, int, Q> >::type Indices(Count);
+	for(std::size_t j = 0; j < Joints.size(); ++j)
+		Joints[j] = dualquat_type(A[j], glm::vec<3, float, Q>(V[j]));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Indices[i] = glm::vec<4, int, Q>(static_cast<int>(i % 64), static_cast<int>((i + 1) % 64), static_cast<int>((i * 7) % 64), static_cast<int>((i * 13) % 64));
+		V[i] = glm::abs(V[i]) / (glm::abs(V[i].x) + glm::abs(V[i].y) + glm::abs(V[i].z) + glm::abs(V[i].w));
+	}
+	Suite.run("dualquat.blend_batch", Count, [&]{ glm::dualquatBlendBatch(&Joints[0], &Indices[0], &V[0], &OutD[0], Count); }, &OutD[0], Count * sizeof(dualquat_type));
+}
+
+static void bench_noise(bench::suite& Suite)
+{
+	unsigned int Seed = 4;
+	bench::array<glm::vec3>::type P(Count);
+	bench::array<glm::vec4>::type P4(Count);
+	bench::array<float>::type Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		P[i] = glm::vec3(uniform(Seed, -64, 64), uniform(Seed, -64, 64), uniform(Seed, -64, 64));
+		P4[i] = glm::vec4(P[i], uniform(Seed, -64, 64));
+	}
+
+	Suite.run("noise.perlin3", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::perlin(P[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("noise.simplex3", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::simplex(P[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("noise.simplex4", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::simplex(P4[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("noise.perlin3_batch", Count, [&]{ glm::perlin(&P[0], &Out[0], Count); }, &Out[0], Count * sizeof(float));
+	Suite.run("noise.simplex3_batch", Count, [&]{ glm::simplex(&P[0], &Out[0], Count); }, &Out[0], Count * sizeof(float));
+	Suite.run("noise.simplex2_grid", Count, [&]{ glm::simplexGrid(glm::vec2(-7, 3), glm::vec2(0.01f), 32, Count / 32, &Out[0], 1); }, &Out[0], Count * sizeof(float));
+}
+
+static void bench_trigonometry(bench::suite& Suite)
+{
+	unsigned int Seed = 5;
+	bench::array<float>::type X(Count), Out(Count);
+	bench::array<vec4_type>::type V(Count), OutV(Count);
+	bench::array<dvec4_type>::type DV(Count), DOutV(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		X[i] = uniform(Seed, -3.14f, 3.14f);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		V[i] = random_vec4(Seed) * 3.14f;
+		DV[i] = dvec4_type(random_vec4(Seed) * 3.14f);
+	}
+
+	Suite.run("trig.sin", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::sin(X[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("trig.fastSin", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::fastSin(X[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("trig.cos", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::cos(X[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("trig.fastCos", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::fastCos(X[i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("trig.atan2", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::atan(X[i], X[Count - 1 - i]); }, &Out[0], Count * sizeof(float));
+	Suite.run("trig.fastAtan2", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Out[i] = glm::fastAtan(X[i], X[Count - 1 - i]); }, &Out[0], Count * sizeof(float));
+
+	// Polynomial SIMD kernels when built with GLM_FORCE_FAST_MATH, the standard library otherwise
+	Suite.run("trig.vec4_sin", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::sin(V[i]); }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("trig.vec4_atan2", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::atan(V[i], V[Count - 1 - i]); }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("trig.vec4_exp", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::exp(V[i]); }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("trig.vec4_log", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::log(glm::abs(V[i])); }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("trig.vec4_pow", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::pow(glm::abs(V[i]), V[Count - 1 - i]); }, &OutV[0], Count * sizeof(vec4_type));
+	Suite.run("trig.dvec4_sin", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) DOutV[i] = glm::sin(DV[i]); }, &DOutV[0], Count * sizeof(dvec4_type));
+	Suite.run("trig.dvec4_exp", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) DOutV[i] = glm::exp(DV[i]); }, &DOutV[0], Count * sizeof(dvec4_type));
+}
+
+static void bench_packing(bench::suite& Suite)
+{
+	unsigned int Seed = 6;
+	bench::array<glm::vec4>::type V(Count), OutV(Count);
+	bench::array<glm::uint32>::type Packed(Count);
+	bench::array<glm::uint64>::type Packed64(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		V[i] = glm::vec4(uniform(Seed, 0, 1), uniform(Seed, 0, 1), uniform(Seed, 0, 1), uniform(Seed, 0, 1));
+
+	Suite.run("pack.half2x16", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Packed[i] = glm::packHalf2x16(glm::vec2(V[i])); }, &Packed[0], Count * sizeof(glm::uint32));
+	Suite.run("pack.unpackHalf2x16", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::vec4(glm::unpackHalf2x16(Packed[i]), 0, 0); }, &OutV[0], Count * sizeof(glm::vec4));
+	Suite.run("pack.half4x16", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Packed64[i] = glm::packHalf4x16(V[i]); }, &Packed64[0], Count * sizeof(glm::uint64));
+	Suite.run("pack.unorm4x8", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Packed[i] = glm::packUnorm4x8(V[i]); }, &Packed[0], Count * sizeof(glm::uint32));
+	Suite.run("pack.unpackUnorm4x8", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) OutV[i] = glm::unpackUnorm4x8(Packed[i]); }, &OutV[0], Count * sizeof(glm::vec4));
+	Suite.run("pack.snorm2x16", Count, [&]{ for(std::size_t i = 0; i < Count; ++i) Packed[i] = glm::packSnorm2x16(glm::vec2(V[i]) * 2.0f - 1.0f); }, &Packed[0], Count * sizeof(glm::uint32));
+
+	// The array conversions, one op per vec4 as above
+	bench::array<glm::uint16>::type Half(Count * 4);
+	bench::array<glm::uint8>::type Unorm(Count * 4);
+	Suite.run("pack.half_batch", Count, [&]{ glm::packHalf(&V[0].x, &Half[0], Count * 4); }, &Half[0], Count * 4 * sizeof(glm::uint16));
+	Suite.run("pack.unpackHalf_batch", Count, [&]{ glm::unpackHalf(&Half[0], &OutV[0].x, Count * 4); }, &OutV[0], Count * sizeof(glm::vec4));
+	Suite.run("pack.unorm8_batch", Count, [&]{ glm::packUnorm(&V[0].x, &Unorm[0], Count * 4); }, &Unorm[0], Count * 4 * sizeof(glm::uint8));
+	Suite.run("pack.unpackUnorm8_batch", Count, [&]{ glm::unpackUnorm(&Unorm[0], &OutV[0].x, Count * 4); }, &OutV[0], Count * sizeof(glm::vec4));
+}
+
+static void bench_intersect(bench::suite& Suite)
+{
+	unsigned int Seed = 7;
+	bench::array<glm::vec3>::type Orig(Count), Dir(Count);
+	bench::array<float>::type Distance(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Orig[i] = glm::vec3(uniform(Seed, -1, 1), uniform(Seed, -1, 1), -5.0f);
+		Dir[i] = glm::normalize(glm::vec3(uniform(Seed, -0.2f, 0.2f), uniform(Seed, -0.2f, 0.2f), 1.0f));
+	}
+
+	glm::vec3 const V0(-1, -1, 0), V1(1, -1, 0), V2(0, 1, 0);
+	Suite.run("intersect.ray_triangle", Count, [&]{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec2 Bary;
+			float Dist = -1.0f;
+			Distance[i] = glm::intersectRayTriangle(Orig[i], Dir[i], V0, V1, V2, Bary, Dist) ? Dist : -1.0f;
+		}
+	}, &Distance[0], Count * sizeof(float));
+
+	glm::vec3 const Center(0.2f, -0.1f, 0.0f);
+	Suite.run("intersect.ray_sphere", Count, [&]{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float Dist = -1.0f;
+			Distance[i] = glm::intersectRaySphere(Orig[i], Dir[i], Center, 0.8f, Dist) ? Dist : -1.0f;
+		}
+	}, &Distance[0], Count * sizeof(float));
+
+	bool Hit[Count];
+	bench::array<glm::vec2>::type Bary(Count);
+	Suite.run("intersect.ray_triangle_batch", Count, [&]{
+		glm::intersectRayTriangle(&Orig[0], &Dir[0], Count, V0, V1, V2, Hit, &Bary[0], &Distance[0]);
+	}, &Distance[0], Count * sizeof(float));
+
+	// The nearest of 64 overlapping triangles per ray
+	bench::array<glm::vec3>::type Triangles(64 * 3);
+	for(std::size_t i = 0; i < Triangles.size(); i += 3)
+	{
+		glm::vec3 const Offset(uniform(Seed, -0.5f, 0.5f), uniform(Seed, -0.5f, 0.5f), uniform(Seed, -2, 2));
+		Triangles[i + 0] = V0 + Offset;
+		Triangles[i + 1] = V1 + Offset;
+		Triangles[i + 2] = V2 + Offset;
+	}
+	std::size_t const Rays = Count / 16;
+	Suite.run("intersect.ray_triangles", Rays * 64, [&]{
+		for(std::size_t i = 0; i < Rays; ++i)
+		{
+			Distance[i] = -1.0f;
+			for(std::size_t t = 0; t < Triangles.size(); t += 3)
+			{
+				glm::vec2 TriangleBary;
+				float Dist = -1.0f;
+				if(glm::intersectRayTriangle(Orig[i], Dir[i], Triangles[t], Triangles[t + 1], Triangles[t + 2], TriangleBary, Dist) && Dist >= 0.0f && (Distance[i] < 0.0f || Dist < Distance[i]))
+					Distance[i] = Dist;
+			}
+		}
+	}, &Distance[0], Rays * sizeof(float));
+	Suite.run("intersect.ray_triangles_batch", Rays * 64, [&]{
+		for(std::size_t i = 0; i < Rays; ++i)
+		{
+			std::size_t Index = 0;
+			float Dist = -1.0f;
+			Distance[i] = glm::intersectRayTriangles(Orig[i], Dir[i], &Triangles[0], Triangles.size() / 3, Bary[i], Dist, Index) ? Dist : -1.0f;
+		}
+	}, &Distance[0], Rays * sizeof(float));
+
+	// A 64 x 64 height field of 8192 triangles, rays cast down onto it
+	std::vector<glm::vec3> Field;
+	for(int y = 0; y < 64; ++y)
+	for(int x = 0; x < 64; ++x)
+	{
+		glm::vec3 Corners[4];
+		for(int k = 0; k < 4; ++k)
+		{
+			int const cx = x + (k & 1), cy = y + (k >> 1);
+			Corners[k] = glm::vec3(cx, cy, static_cast<float>((cx * 7 + cy * 13) % 5) * 0.2f);
+		}
+		glm::vec3 const Quad[6] = {Corners[0], Corners[1], Corners[3], Corners[0], Corners[3], Corners[2]};
+		Field.insert(Field.end(), Quad, Quad + 6);
+	}
+	glm::triangle_bvh<float> BVH;
+	glm::buildTriangleBVH(&Field[0], Field.size() / 3, BVH);
+	std::vector<glm::vec3> FieldOrig(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		FieldOrig[i] = glm::vec3(uniform(Seed, 0, 64), uniform(Seed, 0, 64), 5.0f);
+	glm::vec3 const Down(0.1f, 0.2f, -1.0f);
+	Suite.run("intersect.ray_bvh", Count, [&]{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			std::size_t Index = 0;
+			float Dist = -1.0f;
+			Distance[i] = glm::intersectRayTriangles(FieldOrig[i], Down, BVH, Bary[i], Dist, Index) ? Dist : -1.0f;
+		}
+	}, &Distance[0], Count * sizeof(float));
+}
+
+int main(int argc, char* argv[])
+{
+	bench::options Options;
+	Options.Warmups = 10;
+	Options.Repetitions = 31;
+	Options.RepetitionNs = 2e6;
+	Options.Filter = NULL;
+
+	char const* JsonPath = NULL;
+	for(int i = 1; i < argc; ++i)
+	{
+		if(!std::strcmp(argv[i], "--quick"))
+		{
+			// a smoke run for ctest, the numbers are meaningless
+			Options.Warmups = 1;
+			Options.Repetitions = 3;
+			Options.RepetitionNs = 1e5;
+		}
+		else if(!std::strcmp(argv[i], "--json") && i + 1 < argc)
+			JsonPath = argv[++i];
+		else if(!std::strcmp(argv[i], "--filter") && i + 1 < argc)
+			Options.Filter = argv[++i];
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--quick] [--json file] [--filter name]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	bench::suite Suite(Options);
+	bench_vector(Suite);
+	bench_matrix(Suite);
+	bench_quaternion(Suite);
+	bench_noise(Suite);
+	bench_trigonometry(Suite);
+	bench_packing(Suite);
+	bench_intersect(Suite);
+
+	std::printf("%s:\n", bench::arch_name());
+	Suite.print_table(stdout);
+
+	if(JsonPath)
+	{
+		std::FILE* File = std::fopen(JsonPath, "w");
+		if(!File)
+		{
+			std::fprintf(stderr, "can't write %s\n", JsonPath);
+			return 1;
+		}
+		Suite.print_json(File);
+		std::fclose(File);
+	}
+	return 0;
+}
@@ -10,6 +10,10 @@
 #include <glm/ext/vector_bool4.hpp>
 #include <glm/ext/vector_float1.hpp>
 #include <glm/vector_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <limits>
 
 static int test_vec1()
 {
@@ -730,6 +734,95 @@ static int test_mat2x2()
 	return Error;
 }
 
+static int test_mat4x4()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat4 A(2.0f);
+		constexpr glm::mat4 B = A * glm::mat4(3.0f) + 1.0f;
+		static_assert(B[1][1] == 7.0f && B[1][0] == 1.0f, "GLM: Failed constexpr");
+		static_assert(B - 1.0f == glm::mat4(6.0f), "GLM: Failed constexpr");
+		static_assert(-A / 2.0f == glm::mat4(-1.0f), "GLM: Failed constexpr");
+		static_assert(A * glm::vec4(1, 2, 3, 4) == glm::vec4(2, 4, 6, 8), "GLM: Failed constexpr");
+		static_assert(glm::vec4(1, 2, 3, 4) * A == glm::vec4(2, 4, 6, 8), "GLM: Failed constexpr");
+	}
+
+	{
+		constexpr glm::mat2x3 A(1, 2, 3, 4, 5, 6);
+		constexpr glm::mat3x2 B(1, 2, 3, 4, 5, 6);
+		constexpr glm::mat3 C = A * B;
+		static_assert(C[0] == glm::vec3(9, 12, 15) && C[2] == glm::vec3(29, 40, 51), "GLM: Failed constexpr");
+		static_assert(glm::dot(C[0], glm::vec3(1)) == 36.0f, "GLM: Failed constexpr");
+		static_assert(glm::cross(glm::vec3(1, 0, 0), glm::vec3(0, 1, 0)) == glm::vec3(0, 0, 1), "GLM: Failed constexpr");
+	}
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat4 T = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3));
+		constexpr glm::mat4 S = glm::scale(T, glm::vec3(2));
+		static_assert(T[3] == glm::vec4(1, 2, 3, 1), "GLM: Failed constexpr");
+		static_assert(S * glm::vec4(1, 1, 1, 1) == glm::vec4(3, 4, 5, 1), "GLM: Failed constexpr");
+	}
+
+	{
+		constexpr glm::mat4 O = glm::orthoRH_NO(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+		static_assert(O * glm::vec4(2, 1, -3, 1) == glm::vec4(1, 1, 1, 1), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 F = glm::frustumRH_ZO(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 2.0f);
+		static_assert(F[2][3] == -1.0f && F[3][2] == -2.0f, "GLM: Failed constexpr");
+	}
+
+	// square roots and trigonometric functions need the compiler to tell when it's constant evaluating
+#	if GLM_HAS_IS_CONSTANT_EVALUATED
+	{
+		constexpr glm::mat4 R = glm::rotate(glm::mat4(1.0f), glm::half_pi<float>(), glm::vec3(0, 0, 2));
+		static_assert(glm::all(glm::equal(R * glm::vec4(1, 0, 0, 1), glm::vec4(0, 1, 0, 1), 0.000001f)), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 P = glm::perspectiveRH_NO(glm::half_pi<float>(), 2.0f, 1.0f, 3.0f);
+		static_assert(glm::abs(P[1][1] - 1.0f) < 0.000001f && glm::abs(P[0][0] - 0.5f) < 0.000001f, "GLM: Failed constexpr");
+
+		// the same transforms evaluated at run time
+		constexpr glm::mat4 Rotates[] = {
+			glm::rotate(glm::mat4(1.0f), -7.3f, glm::vec3(1, 2, 3)),
+			glm::rotate(glm::mat4(1.0f), -1.5f, glm::vec3(1, 2, 3)),
+			glm::rotate(glm::mat4(1.0f), 0.4f, glm::vec3(1, 2, 3)),
+			glm::rotate(glm::mat4(1.0f), 3.1f, glm::vec3(1, 2, 3)),
+			glm::rotate(glm::mat4(1.0f), 12.5f, glm::vec3(1, 2, 3))};
+		constexpr glm::mat4 Perspectives[] = {
+			glm::perspective(0.2f, 1.5f, 0.1f, 100.0f),
+			glm::perspective(0.7f, 1.5f, 0.1f, 100.0f),
+			glm::perspective(1.2f, 1.5f, 0.1f, 100.0f),
+			glm::perspective(2.1f, 1.5f, 0.1f, 100.0f),
+			glm::perspective(3.0f, 1.5f, 0.1f, 100.0f)};
+		float const Angles[] = {-7.3f, -1.5f, 0.4f, 3.1f, 12.5f};
+		float const Fovs[] = {0.2f, 0.7f, 1.2f, 2.1f, 3.0f};
+		for(std::size_t i = 0; i < sizeof(Angles) / sizeof(Angles[0]); ++i)
+		{
+			Error += glm::all(glm::equal(Rotates[i], glm::rotate(glm::mat4(1.0f), Angles[i], glm::vec3(1, 2, 3)), 0.000001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Perspectives[i], glm::perspective(Fovs[i], 1.5f, 0.1f, 100.0f), 0.00001f)) ? 0 : 1;
+		}
+
+		// large angles reduce without overflowing; 1e5 is still exact enough to match run time
+		constexpr glm::mat4 Far = glm::rotate(glm::mat4(1.0f), 1e5f, glm::vec3(1, 2, 3));
+		Error += glm::all(glm::equal(Far, glm::rotate(glm::mat4(1.0f), 1e5f, glm::vec3(1, 2, 3)), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::dmat4 Huge = glm::rotate(glm::dmat4(1.0), 1e300, glm::dvec3(0, 0, 1));
+		static_assert(glm::abs(Huge[0][0] * Huge[0][0] + Huge[0][1] * Huge[0][1] - 1.0) < 0.000001, "GLM: Failed constexpr");
+		constexpr glm::mat4 Max = glm::rotate(glm::mat4(1.0f), -std::numeric_limits<float>::max(), glm::vec3(0, 0, 1));
+		static_assert(glm::abs(Max[0][0] * Max[0][0] + Max[0][1] * Max[0][1] - 1.0f) < 0.000001f, "GLM: Failed constexpr");
+	}
+#	endif//GLM_HAS_IS_CONSTANT_EVALUATED
+
+	return Error;
+}
+
 #endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 int main()
@@ -743,6 +836,8 @@ int main()
 		Error += test_vec4();
 		Error += test_quat();
 		Error += test_mat2x2();
+		Error += test_mat4x4();
+		Error += test_transform();
 #	endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 	return Error;
@@ -0,0 +1,160 @@
+#define GLM_FORCE_FAST_MATH
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
+
+#include <glm/glm.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <limits>
+
+template<typename vecType, typename T>
+static vecType sweep(T Min, T Max, int i, int Count)
+{
+	T const Step = (Max - Min) / static_cast<T>(Count * 4);
+	return vecType(
+		Min + Step * static_cast<T>(i * 4 + 0),
+		Min + Step * static_cast<T>(i * 4 + 1),
+		Min + Step * static_cast<T>(i * 4 + 2),
+		Min + Step * static_cast<T>(i * 4 + 3));
+}
+
+template<typename vecType, typename T>
+static int test_sin_cos(int ULPs)
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		vecType const x = sweep<vecType>(-glm::pi<T>(), glm::pi<T>(), i, 1000);
+		vecType const s = glm::sin(x);
+		vecType const c = glm::cos(x);
+		vecType const S(std::sin(x.x), std::sin(x.y), std::sin(x.z), std::sin(x.w));
+		vecType const C(std::cos(x.x), std::cos(x.y), std::cos(x.z), std::cos(x.w));
+
+		// Close to the zeros of sin and cos the error is absolute
+		Error += glm::all(glm::equal(s, S, ULPs) || glm::equal(s, S, glm::epsilon<T>())) ? 0 : 1;
+		Error += glm::all(glm::equal(c, C, ULPs) || glm::equal(c, C, glm::epsilon<T>())) ? 0 : 1;
+	}
+
+	// Over many periods only the absolute error is bounded
+	for(int i = 0; i < 1000; ++i)
+	{
+		vecType const x = sweep<vecType>(static_cast<T>(-8192), static_cast<T>(8192), i, 1000);
+		vecType const s = glm::sin(x);
+		Error += glm::all(glm::equal(s, vecType(std::sin(x.x), std::sin(x.y), std::sin(x.z), std::sin(x.w)), static_cast<T>(1e-6))) ? 0 : 1;
+	}
+
+	T const Inf = std::numeric_limits<T>::infinity();
+	vecType const n = glm::sin(vecType(Inf, -Inf, std::numeric_limits<T>::quiet_NaN(), static_cast<T>(0)));
+	Error += glm::isnan(n.x) && glm::isnan(n.y) && glm::isnan(n.z) ? 0 : 1;
+	Error += n.w == static_cast<T>(0) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType, typename T>
+static int test_atan2(int ULPs)
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		vecType const y = sweep<vecType>(static_cast<T>(-10), static_cast<T>(10), i, 1000);
+		vecType const x = sweep<vecType>(static_cast<T>(7), static_cast<T>(-7), i, 1000);
+		vecType const a = glm::atan(y, x);
+		Error += glm::all(glm::equal(a, vecType(std::atan2(y.x, x.x), std::atan2(y.y, x.y), std::atan2(y.z, x.z), std::atan2(y.w, x.w)), ULPs)) ? 0 : 1;
+	}
+
+	T const Zero = static_cast<T>(0);
+	vecType const q = glm::atan(vecType(Zero, -Zero, Zero, -Zero), vecType(Zero, Zero, -Zero, -Zero));
+	Error += glm::all(glm::equal(q, vecType(Zero, -Zero, glm::pi<T>(), -glm::pi<T>()), 0)) ? 0 : 1;
+
+	T const Inf = std::numeric_limits<T>::infinity();
+	T const QuarterPi = glm::quarter_pi<T>();
+	vecType const d = glm::atan(vecType(Inf, Inf, -Inf, -Inf), vecType(Inf, -Inf, Inf, -Inf));
+	Error += glm::all(glm::equal(d, vecType(QuarterPi, QuarterPi * static_cast<T>(3), -QuarterPi, -QuarterPi * static_cast<T>(3)), ULPs)) ? 0 : 1;
+
+	vecType const h = glm::atan(vecType(static_cast<T>(1), Inf, static_cast<T>(1), std::numeric_limits<T>::quiet_NaN()), vecType(Inf, static_cast<T>(1), -Inf, static_cast<T>(1)));
+	Error += glm::all(glm::equal(glm::vec<3, T, glm::defaultp>(h), glm::vec<3, T, glm::defaultp>(Zero, glm::half_pi<T>(), glm::pi<T>()), ULPs)) ? 0 : 1;
+	Error += glm::isnan(h.w) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType, typename T>
+static int test_exp_log(int ULPs)
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		vecType const x = sweep<vecType>(static_cast<T>(-80), static_cast<T>(80), i, 1000);
+		vecType const e = glm::exp(x);
+		Error += glm::all(glm::equal(e, vecType(std::exp(x.x), std::exp(x.y), std::exp(x.z), std::exp(x.w)), ULPs)) ? 0 : 1;
+
+		vecType const l = glm::log(e);
+		Error += glm::all(glm::equal(l, vecType(std::log(e.x), std::log(e.y), std::log(e.z), std::log(e.w)), ULPs)) ? 0 : 1;
+	}
+
+	T const Inf = std::numeric_limits<T>::infinity();
+	vecType const e = glm::exp(vecType(Inf, -Inf, static_cast<T>(1000), static_cast<T>(0)));
+	Error += e.x == Inf && e.y == static_cast<T>(0) && e.z == Inf && e.w == static_cast<T>(1) ? 0 : 1;
+
+	vecType const l = glm::log(vecType(Inf, static_cast<T>(0), static_cast<T>(-1), static_cast<T>(1)));
+	Error += l.x == Inf && l.y == -Inf && glm::isnan(l.z) && l.w == static_cast<T>(0) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename vecType, typename T>
+static int test_pow(int ULPs)
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		vecType const x = sweep<vecType>(static_cast<T>(0.01), static_cast<T>(10), i, 1000);
+		vecType const y = sweep<vecType>(static_cast<T>(-2.5), static_cast<T>(2.5), i, 1000);
+		vecType const p = glm::pow(x, y);
+		Error += glm::all(glm::equal(p, vecType(std::pow(x.x, y.x), std::pow(x.y, y.y), std::pow(x.z, y.z), std::pow(x.w, y.w)), ULPs)) ? 0 : 1;
+	}
+
+	vecType const p = glm::pow(vecType(static_cast<T>(0), static_cast<T>(-2), static_cast<T>(-2), static_cast<T>(-2)), vecType(static_cast<T>(0), static_cast<T>(3), static_cast<T>(2), static_cast<T>(0.5)));
+	Error += glm::all(glm::equal(glm::vec<3, T, glm::defaultp>(p), glm::vec<3, T, glm::defaultp>(1, -8, 4), ULPs)) ? 0 : 1;
+	Error += glm::isnan(p.w) ? 0 : 1;
+
+	// 1 wins over NaN and infinite exponents
+	T const Inf = std::numeric_limits<T>::infinity();
+	T const NaN = std::numeric_limits<T>::quiet_NaN();
+	T const One = static_cast<T>(1);
+	vecType const u = glm::pow(vecType(One, One, -One, -One), vecType(NaN, Inf, Inf, -Inf));
+	Error += glm::all(glm::equal(u, vecType(One), 0)) ? 0 : 1;
+	vecType const v = glm::pow(vecType(One, NaN, static_cast<T>(0.5), static_cast<T>(2)), vecType(-Inf, static_cast<T>(0), Inf, -Inf));
+	Error += glm::all(glm::equal(v, vecType(One, One, static_cast<T>(0), static_cast<T>(0)), 0)) ? 0 : 1;
+
+	// Signed zeros keep their sign for odd integer exponents only
+	T const Zero = static_cast<T>(0);
+	vecType const z = glm::pow(vecType(-Zero, -Zero, -Zero, -Zero), vecType(static_cast<T>(-3), static_cast<T>(3), static_cast<T>(2), static_cast<T>(0.5)));
+	Error += z.x == -Inf && z.y == Zero && std::signbit(z.y) ? 0 : 1;
+	Error += z.z == Zero && !std::signbit(z.z) && z.w == Zero && !std::signbit(z.w) ? 0 : 1;
+	vecType const w = glm::pow(vecType(Zero, -Inf, -Inf, NaN), vecType(static_cast<T>(-3), static_cast<T>(3), static_cast<T>(-3), One));
+	Error += w.x == Inf && w.y == -Inf && w.z == Zero && std::signbit(w.z) && glm::isnan(w.w) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_sin_cos<glm::vec4, float>(4);
+	Error += test_sin_cos<glm::dvec4, double>(4);
+	Error += test_atan2<glm::vec4, float>(5);
+	Error += test_atan2<glm::dvec4, double>(4);
+	Error += test_exp_log<glm::vec4, float>(2);
+	Error += test_exp_log<glm::dvec4, double>(2);
+	Error += test_pow<glm::vec4, float>(24);
+	Error += test_pow<glm::dvec4, double>(24);
+
+	return Error;
+}
@@ -175,6 +175,8 @@ int test_instruction_set()
 		std::printf("ARM ");
 	if(GLM_ARCH & GLM_ARCH_NEON_BIT)
 		std::printf("NEON ");
+	if(GLM_ARCH & GLM_ARCH_AVX512)
+		std::printf("AVX512 ");
 	if(GLM_ARCH & GLM_ARCH_AVX2)
 		std::printf("AVX2 ");
 	if(GLM_ARCH & GLM_ARCH_AVX)
@@ -2,6 +2,7 @@
 #include <glm/gtc/noise.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <vector>
 
 static int test_simplex_float()
 {
@@ -69,6 +70,63 @@ static int test_perlin_pedioric_double()
 	return Error;
 }
 
+template<glm::length_t L, typename T>
+static int test_batch()
+{
+	int Error = 0;
+
+	// Every tail length of a packet, on points covering negative and positive cells
+	for(std::size_t Count = 1; Count < 40; Count += 3)
+	{
+		std::vector<glm::vec<L, T> > Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			for(glm::length_t c = 0; c < L; ++c)
+				Points[i][c] = static_cast<T>(static_cast<double>((i * 7 + static_cast<std::size_t>(c) * 13) % 41) * 0.73 - 14.1);
+
+		std::vector<T> Perlin(Count + 1, T(-9)), Simplex(Count + 1, T(-9));
+		glm::perlin(&Points[0], &Perlin[0], Count);
+		glm::simplex(&Points[0], &Simplex[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::abs(Perlin[i] - glm::perlin(Points[i])) < static_cast<T>(1e-4) ? 0 : 1;
+			Error += glm::abs(Simplex[i] - glm::simplex(Points[i])) < static_cast<T>(1e-4) ? 0 : 1;
+		}
+		Error += Perlin[Count] == T(-9) ? 0 : 1;
+		Error += Simplex[Count] == T(-9) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_grid()
+{
+	int Error = 0;
+
+	std::size_t const Width = 37;
+	std::size_t const Height = 11;
+	glm::vec<2, T> const Origin(T(-3.5), T(2.25));
+	glm::vec<2, T> const Step(T(0.17), T(-0.31));
+
+	for(unsigned int Threads = 0; Threads < 4; ++Threads)
+	{
+		std::vector<T> Perlin(Width * Height), Simplex(Width * Height);
+		glm::perlinGrid(Origin, Step, Width, Height, &Perlin[0], Threads);
+		glm::simplexGrid(Origin, Step, Width, Height, &Simplex[0], Threads);
+
+		for(std::size_t y = 0; y < Height; ++y)
+		for(std::size_t x = 0; x < Width; ++x)
+		{
+			glm::vec<2, T> const p(Origin.x + Step.x * static_cast<T>(x), Origin.y + Step.y * static_cast<T>(y));
+			Error += glm::abs(Perlin[y * Width + x] - glm::perlin(p)) < static_cast<T>(1e-4) ? 0 : 1;
+			Error += glm::abs(Simplex[y * Width + x] - glm::simplex(p)) < static_cast<T>(1e-4) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -82,5 +140,14 @@ int main()
 	Error += test_perlin_pedioric_float();
 	Error += test_perlin_pedioric_double();
 
+	Error += test_batch<2, float>();
+	Error += test_batch<3, float>();
+	Error += test_batch<4, float>();
+	Error += test_batch<2, double>();
+	Error += test_batch<3, double>();
+
+	Error += test_grid<float>();
+	Error += test_grid<double>();
+
 	return Error;
 }
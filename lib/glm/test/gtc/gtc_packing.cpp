@@ -1,6 +1,7 @@
 #include <glm/packing.hpp>
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/ext/scalar_relational.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <cstdio>
 #include <vector>
@@ -572,6 +573,83 @@ int test_packSnorm()
 	return Error;
 }
 
+int test_packHalfArray()
+{
+	int Error = 0;
+
+	// a length that leaves a partial block for every kernel width
+	std::vector<float> A;
+	A.push_back(0.0f);
+	A.push_back(-0.0f);
+	A.push_back(1.0f);
+	A.push_back(-2.5f);
+	A.push_back(65504.0f);
+	A.push_back(65520.0f); // rounds to infinity
+	A.push_back(1e-7f); // subnormal half
+	A.push_back(1.0f + 1.0f / 2048.0f); // tie, rounds to even
+	A.push_back(1.0f + 3.0f / 2048.0f); // tie, rounds to even
+	for(int i = 0; i < 28; ++i)
+		A.push_back(static_cast<float>(i) * 0.37f - 5.0f);
+
+	std::vector<glm::uint16> P(A.size() + 1, 0x1234);
+	std::vector<float> B(A.size() + 1, 42.0f);
+	glm::packHalf(&A[0], &P[0], A.size());
+	glm::unpackHalf(&P[0], &B[0], A.size());
+
+	Error += P[5] == 0x7c00 ? 0 : 1;
+	Error += P[6] == 0x0002 ? 0 : 1;
+	Error += P[7] == 0x3c00 ? 0 : 1;
+	Error += P[8] == 0x3c02 ? 0 : 1;
+	for(std::size_t i = 0; i < A.size(); ++i)
+	{
+		// away from ties, the same as the single value functions
+		if(i != 7 && i != 8)
+			Error += P[i] == glm::packHalf1x16(A[i]) ? 0 : 1;
+		Error += B[i] == glm::unpackHalf1x16(P[i]) ? 0 : 1;
+	}
+	Error += P[A.size()] == 0x1234 && B[A.size()] == 42.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_packNormArray()
+{
+	int Error = 0;
+
+	std::vector<float> A;
+	for(int i = 0; i < 37; ++i)
+		A.push_back(static_cast<float>(i) * 0.061f - 1.1f);
+	A.push_back(0.5f / 255.0f);
+	A.push_back(-0.5f / 127.0f);
+
+	std::vector<glm::uint8> U8(A.size());
+	std::vector<glm::uint16> U16(A.size());
+	std::vector<glm::int8> I8(A.size());
+	std::vector<glm::int16> I16(A.size());
+	glm::packUnorm(&A[0], &U8[0], A.size());
+	glm::packUnorm(&A[0], &U16[0], A.size());
+	glm::packSnorm(&A[0], &I8[0], A.size());
+	glm::packSnorm(&A[0], &I16[0], A.size());
+
+	// With x87 math the single value results keep excess precision until they
+	// are stored, so they are compared with the stored values in ULPs
+	std::vector<float> B(A.size());
+	glm::unpackUnorm(&U8[0], &B[0], A.size());
+	for(std::size_t i = 0; i < A.size(); ++i)
+	{
+		Error += U8[i] == glm::packUnorm1x8(A[i]) ? 0 : 1;
+		Error += U16[i] == glm::packUnorm1x16(A[i]) ? 0 : 1;
+		Error += I8[i] == glm::packSnorm<glm::int8>(glm::vec1(A[i])).x ? 0 : 1;
+		Error += I16[i] == glm::packSnorm<glm::int16>(glm::vec1(A[i])).x ? 0 : 1;
+		Error += glm::equal(B[i], glm::unpackUnorm1x8(U8[i]), 1) ? 0 : 1;
+	}
+	glm::unpackSnorm(&I16[0], &B[0], A.size());
+	for(std::size_t i = 0; i < A.size(); ++i)
+		Error += glm::equal(B[i], glm::unpackSnorm<float>(glm::i16vec1(I16[i])).x, 1) ? 0 : 1;
+
+	return Error;
+}
+
 int test_packUnorm2x4()
 {
 	int Error = 0;
@@ -828,6 +906,8 @@ int main()
 
 	Error += test_packUnorm();
 	Error += test_packSnorm();
+	Error += test_packHalfArray();
+	Error += test_packNormArray();
 
 	Error += test_packSnorm1x16();
 	Error += test_packSnorm2x16();
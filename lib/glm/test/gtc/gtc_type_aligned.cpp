@@ -5,6 +5,9 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 GLM_STATIC_ASSERT(glm::detail::is_aligned<glm::aligned_lowp>::value, "aligned_lowp is not aligned");
 GLM_STATIC_ASSERT(glm::detail::is_aligned<glm::aligned_mediump>::value, "aligned_mediump is not aligned");
@@ -159,6 +162,80 @@ static int test_aligned_mat4()
 	return Error;
 }
 
+// The aligned double types take the SSE2 and AVX paths, the packed ones the scalar code
+static int test_aligned_dvec()
+{
+	int Error = 0;
+
+	glm::aligned_dvec2 const a2(3.0, -4.0), b2(0.5, 0.25);
+	glm::dvec2 const p2(3.0, -4.0), q2(0.5, 0.25);
+	Error += glm::all(glm::equal(glm::dvec2(a2 * b2 + a2 / b2 - b2), p2 * q2 + p2 / q2 - q2, 1e-12)) ? 0 : 1;
+	Error += glm::equal(glm::dot(a2, b2), glm::dot(p2, q2), 1e-12) ? 0 : 1;
+	Error += glm::equal(glm::length(a2), 5.0, 1e-12) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::normalize(a2)), glm::dvec2(0.6, -0.8), 1e-12)) ? 0 : 1;
+
+	glm::aligned_dvec4 const a4(1.0, -2.0, 3.0, 0.5), b4(0.25, 4.0, -1.5, 2.0);
+	glm::dvec4 const p4(1.0, -2.0, 3.0, 0.5), q4(0.25, 4.0, -1.5, 2.0);
+	Error += glm::all(glm::equal(glm::dvec4(a4 * b4 + a4 / b4 - b4 * 2.0), p4 * q4 + p4 / q4 - q4 * 2.0, 1e-12)) ? 0 : 1;
+	Error += glm::equal(glm::dot(a4, b4), glm::dot(p4, q4), 1e-12) ? 0 : 1;
+	Error += glm::equal(glm::length(a4), glm::length(p4), 1e-12) ? 0 : 1;
+	Error += glm::equal(glm::distance(a4, b4), glm::distance(p4, q4), 1e-12) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec4(glm::normalize(a4)), glm::normalize(p4), 1e-12)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_aligned_dmat4()
+{
+	int Error = 0;
+
+	glm::dmat4 const p(1, -2, 3, 4, 0.5, 6, -7, 8, 9, 10, 0.25, -12, 13, 14, 15, 1);
+	glm::dmat4 const q(0.5, 0, 1, 2, -1, 3, 0, 1, 2, 1, 4, -2, 1, 1, 1, 1);
+	glm::dvec4 const v(0.5, -1.5, 2, 1);
+	glm::aligned_dmat4 const a(p), b(q);
+
+	Error += glm::all(glm::equal(glm::dmat4(a * b), p * q, 1e-12)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec4(a * glm::aligned_dvec4(v)), p * v, 1e-12)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_aligned_quat()
+{
+	int Error = 0;
+
+	typedef glm::qua<double, glm::aligned_highp> aligned_dquat;
+	typedef glm::qua<float, glm::aligned_highp> aligned_fquat;
+
+	glm::dquat const p = glm::angleAxis(0.7, glm::normalize(glm::dvec3(1, 2, 3)));
+	glm::dquat const q = glm::angleAxis(-1.3, glm::normalize(glm::dvec3(-2, 0.5, 1)));
+	aligned_dquat const a(p), b(q);
+
+	aligned_dquat c = a;
+	c += b;
+	c *= 3.0;
+	c -= b;
+	c /= 2.0;
+	Error += glm::all(glm::equal(glm::dquat(c), ((p + q) * 3.0 - q) / 2.0, 1e-12)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dquat(a * 2.0 + b / 4.0), p * 2.0 + q / 4.0, 1e-12)) ? 0 : 1;
+	Error += glm::equal(glm::dot(a, b), glm::dot(p, q), 1e-12) ? 0 : 1;
+	Error += glm::equal(glm::length(a), 1.0, 1e-12) ? 0 : 1;
+
+	glm::dvec4 const v(1, -2, 0.5, 3);
+	Error += glm::all(glm::equal(glm::dvec4(a * glm::aligned_dvec4(v)), p * v, 1e-12)) ? 0 : 1;
+
+	aligned_fquat f(glm::quat(0.5f, 0.5f, -0.5f, 0.5f));
+	f += aligned_fquat(glm::quat(1, 0, 0, 0));
+	f -= aligned_fquat(glm::quat(0.5f, 0, 0, 0));
+	f *= 2.0f;
+	f /= 4.0f;
+	Error += glm::all(glm::equal(glm::quat(f), glm::quat(0.5f, 0.25f, -0.25f, 0.25f), 0.0001f)) ? 0 : 1;
+	glm::vec4 const u = glm::quat(0.5f, 0.5f, -0.5f, 0.5f) * glm::vec4(1, 2, 3, 4);
+	Error += glm::all(glm::equal(glm::vec4(aligned_fquat(glm::quat(0.5f, 0.5f, -0.5f, 0.5f)) * glm::aligned_vec4(1, 2, 3, 4)), u, 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -167,6 +244,9 @@ int main()
 	Error += test_copy();
 	Error += test_aligned_ivec4();
 	Error += test_aligned_mat4();
+	Error += test_aligned_dvec();
+	Error += test_aligned_dmat4();
+	Error += test_aligned_quat();
 
 	return Error;
 }
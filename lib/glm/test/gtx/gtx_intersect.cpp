@@ -2,6 +2,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/intersect.hpp>
+#include <vector>
 
 int test_intersectRayPlane()
 {
@@ -76,6 +77,190 @@ int test_intersectLineTriangle()
 	return Error;
 }
 
+template<typename T>
+static int test_intersectRayTriangleBatch()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	vec3Type const Vert0(-1, -1, 0);
+	vec3Type const Vert1(1, -1, 0);
+	vec3Type const Vert2(0, 1, 0);
+
+	// every length up to a few AVX-512 registers, so each tail size is covered
+	for(std::size_t Count = 0; Count <= 35; ++Count)
+	{
+		std::vector<vec3Type> Orig(Count + 1, vec3Type(0)), Dir(Count + 1, vec3Type(0));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			// a grid of origins clear of the triangle edges, some rays pointing away
+			T const x = static_cast<T>(static_cast<int>(i * 7 % 11) - 5) / static_cast<T>(4) + static_cast<T>(0.03);
+			T const y = static_cast<T>(static_cast<int>(i * 3 % 7) - 3) / static_cast<T>(3) + static_cast<T>(0.05);
+			Orig[i] = vec3Type(x, y, i % 4 == 3 ? 5 : -5);
+			Dir[i] = vec3Type(static_cast<T>(i % 3) * static_cast<T>(0.01), 0, i % 5 == 4 ? -1 : 1);
+		}
+
+		bool Hit[36];
+		std::vector<vec2Type> Bary(Count + 1, vec2Type(7));
+		std::vector<T> Distance(Count + 1, static_cast<T>(7));
+		glm::intersectRayTriangle(&Orig[0], &Dir[0], Count, Vert0, Vert1, Vert2, Hit, &Bary[0], &Distance[0]);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec2Type ExpectedBary(0);
+			T ExpectedDistance(0);
+			bool const Expected = glm::intersectRayTriangle(Orig[i], Dir[i], Vert0, Vert1, Vert2, ExpectedBary, ExpectedDistance);
+			Error += Hit[i] == Expected ? 0 : 1;
+			if(!Expected)
+				continue;
+			Error += glm::all(glm::epsilonEqual(Bary[i], ExpectedBary, static_cast<T>(0.0001))) ? 0 : 1;
+			Error += glm::abs(Distance[i] - ExpectedDistance) <= static_cast<T>(0.0001) ? 0 : 1;
+		}
+		// one guard element past the end must be left alone
+		Error += glm::all(glm::equal(Bary[Count], vec2Type(7))) && Distance[Count] == static_cast<T>(7) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// nearest hit in front of the ray, one triangle at a time
+template<typename T>
+static bool nearestRayTriangle(glm::vec<3, T, glm::defaultp> const& Orig, glm::vec<3, T, glm::defaultp> const& Dir, std::vector<glm::vec<3, T, glm::defaultp> > const& Vertices, T& Distance, std::size_t& Index)
+{
+	bool Result = false;
+	for(std::size_t i = 0; i < Vertices.size() / 3; ++i)
+	{
+		glm::vec<2, T, glm::defaultp> Bary(0);
+		T Current(0);
+		if(glm::intersectRayTriangle(Orig, Dir, Vertices[i * 3 + 0], Vertices[i * 3 + 1], Vertices[i * 3 + 2], Bary, Current) && Current >= static_cast<T>(0) && (!Result || Current < Distance))
+		{
+			Distance = Current;
+			Index = i;
+			Result = true;
+		}
+	}
+	return Result;
+}
+
+template<typename T>
+static int test_intersectRayTriangles()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count <= 35; ++Count)
+	{
+		// a stack of shifted triangles across z = 0, the nearest in front of the ray wins
+		std::vector<vec3Type> Vertices;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const z = static_cast<T>(static_cast<int>(i * 5 % 13) - 6) * static_cast<T>(0.5);
+			T const x = static_cast<T>(i % 3) * static_cast<T>(0.25);
+			Vertices.push_back(vec3Type(x - 1, -1, z));
+			Vertices.push_back(vec3Type(x + 1, -1, z + static_cast<T>(0.1)));
+			Vertices.push_back(vec3Type(x, 1, z));
+		}
+
+		vec3Type const Orig(static_cast<T>(0.35), static_cast<T>(-0.2), static_cast<T>(0.2));
+		vec3Type const Dir[] = {vec3Type(0, 0, 1), vec3Type(0, 0, -1), vec3Type(0, 1, 0)};
+		for(std::size_t d = 0; d < sizeof(Dir) / sizeof(Dir[0]); ++d)
+		{
+			T ExpectedDistance(0);
+			std::size_t ExpectedIndex = 0;
+			bool const Expected = nearestRayTriangle(Orig, Dir[d], Vertices, ExpectedDistance, ExpectedIndex);
+
+			vec2Type Bary(0);
+			T Distance(0);
+			std::size_t Index = 0;
+			bool const Result = glm::intersectRayTriangles(Orig, Dir[d], Vertices.empty() ? NULL : &Vertices[0], Count, Bary, Distance, Index);
+			Error += Result == Expected ? 0 : 1;
+			if(!Expected)
+				continue;
+			Error += Index == ExpectedIndex ? 0 : 1;
+			Error += glm::abs(Distance - ExpectedDistance) <= static_cast<T>(0.0001) ? 0 : 1;
+
+			vec3Type const Position = Vertices[Index * 3] + Bary.x * (Vertices[Index * 3 + 1] - Vertices[Index * 3]) + Bary.y * (Vertices[Index * 3 + 2] - Vertices[Index * 3]);
+			Error += glm::all(glm::epsilonEqual(Position, Orig + Dir[d] * Distance, static_cast<T>(0.0001))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_intersectRayTrianglesBVH()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	// a bumpy height field of two triangles per cell
+	int const Size = 24;
+	std::vector<vec3Type> Vertices;
+	for(int y = 0; y < Size; ++y)
+	for(int x = 0; x < Size; ++x)
+	{
+		vec3Type Corners[4];
+		for(int k = 0; k < 4; ++k)
+		{
+			int const cx = x + (k & 1);
+			int const cy = y + (k >> 1);
+			Corners[k] = vec3Type(cx, cy, static_cast<T>((cx * 7 + cy * 13) % 5) * static_cast<T>(0.3));
+		}
+		Vertices.push_back(Corners[0]);
+		Vertices.push_back(Corners[1]);
+		Vertices.push_back(Corners[3]);
+		Vertices.push_back(Corners[0]);
+		Vertices.push_back(Corners[3]);
+		Vertices.push_back(Corners[2]);
+	}
+
+	glm::triangle_bvh<T> BVH;
+	glm::buildTriangleBVH(&Vertices[0], Vertices.size() / 3, BVH);
+	Error += BVH.Indices.size() == Vertices.size() / 3 ? 0 : 1;
+	for(std::size_t i = 0; i < BVH.Nodes.size(); ++i)
+		Error += BVH.Nodes[i].Count <= 8 ? 0 : 1;
+
+	for(int i = 0; i < 200; ++i)
+	{
+		// rays down onto the field, oblique ones and ones along the axes, clear of the cell diagonals
+		T const x = static_cast<T>(i * 7 % Size) + static_cast<T>(0.37);
+		T const y = static_cast<T>(i * 11 % Size) + static_cast<T>(0.61);
+		vec3Type const Orig = i % 4 == 3 ? vec3Type(-1, y, static_cast<T>(0.45)) : vec3Type(x, y, 5);
+		vec3Type const Dir =
+			i % 4 == 0 ? vec3Type(0, 0, -1) :
+			i % 4 == 1 ? vec3Type(static_cast<T>(0.3), static_cast<T>(-0.2), -1) :
+			i % 4 == 2 ? vec3Type(0, 0, 1) : vec3Type(1, 0, 0);
+
+		T ExpectedDistance(0);
+		std::size_t ExpectedIndex = 0;
+		bool const Expected = nearestRayTriangle(Orig, Dir, Vertices, ExpectedDistance, ExpectedIndex);
+
+		vec2Type Bary(0);
+		T Distance(0);
+		std::size_t Index = 0;
+		bool const Result = glm::intersectRayTriangles(Orig, Dir, BVH, Bary, Distance, Index);
+		Error += Result == Expected ? 0 : 1;
+		if(!Expected || !Result)
+			continue;
+		Error += glm::abs(Distance - ExpectedDistance) <= static_cast<T>(0.0001) ? 0 : 1;
+		Error += Index == ExpectedIndex ? 0 : 1;
+	}
+
+	glm::triangle_bvh<T> Empty;
+	glm::buildTriangleBVH(static_cast<vec3Type const*>(NULL), 0, Empty);
+	vec2Type Bary(0);
+	T Distance(0);
+	std::size_t Index = 0;
+	Error += glm::intersectRayTriangles(vec3Type(0), vec3Type(0, 0, 1), Empty, Bary, Distance, Index) ? 1 : 0;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -83,6 +268,12 @@ int main()
 	Error += test_intersectRayPlane();
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle();
+	Error += test_intersectRayTriangleBatch<float>();
+	Error += test_intersectRayTriangleBatch<double>();
+	Error += test_intersectRayTriangles<float>();
+	Error += test_intersectRayTriangles<double>();
+	Error += test_intersectRayTrianglesBVH<float>();
+	Error += test_intersectRayTrianglesBVH<double>();
 
 	return Error;
 }
@@ -0,0 +1,173 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion_batch.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+
+// every length up to a few full AVX registers, so each tail size is covered
+static std::size_t const MaxCount = 35;
+
+template<typename T>
+static glm::qua<T, glm::defaultp> sample(std::size_t i)
+{
+	T const t = static_cast<T>(i);
+	glm::vec<3, T, glm::defaultp> const Axis = glm::normalize(glm::vec<3, T, glm::defaultp>(static_cast<T>(0.3) + t, static_cast<T>(1), static_cast<T>(2) - t * static_cast<T>(0.25)));
+	return glm::angleAxis(t * static_cast<T>(0.7) - static_cast<T>(3), Axis);
+}
+
+template<typename T>
+static int test_mul()
+{
+	int Error = 0;
+
+	typedef glm::qua<T, glm::defaultp> quatType;
+	for(std::size_t Count = 0; Count <= MaxCount; ++Count)
+	{
+		// one guard element past the end must be left alone
+		std::vector<quatType> A(Count + 1, quatType(1, 0, 0, 0)), B(Count + 1, quatType(1, 0, 0, 0)), Out(Count + 1, quatType(7, 7, 7, 7));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			A[i] = sample<T>(i);
+			B[i] = sample<T>(i + 11);
+		}
+
+		glm::mulBatch(&A[0], &B[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], A[i] * B[i], static_cast<T>(0.00001))) ? 0 : 1;
+		Error += Out[Count] == quatType(7, 7, 7, 7) ? 0 : 1;
+
+		// in place
+		glm::mulBatch(&A[0], &B[0], &A[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += A[i] == Out[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_slerp()
+{
+	int Error = 0;
+
+	typedef glm::qua<T, glm::defaultp> quatType;
+	for(std::size_t Count = 0; Count <= MaxCount; ++Count)
+	{
+		std::vector<quatType> A(Count + 1, quatType(1, 0, 0, 0)), B(Count + 1, quatType(1, 0, 0, 0)), Out(Count + 1, quatType(7, 7, 7, 7));
+		std::vector<T> Factors(Count + 1, static_cast<T>(0));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			A[i] = sample<T>(i);
+			// opposite hemispheres, nearly equal rotations and the same one
+			B[i] = i % 3 == 0 ? -sample<T>(i + 5) : i % 3 == 1 ? glm::normalize(A[i] + quatType(0, static_cast<T>(1e-4), 0, 0)) : A[i];
+			Factors[i] = static_cast<T>(i % 5) * static_cast<T>(0.25);
+		}
+
+		glm::slerpBatch(&A[0], &B[0], static_cast<T>(0.3), &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::slerp(A[i], B[i], static_cast<T>(0.3)), static_cast<T>(0.00001))) ? 0 : 1;
+		Error += Out[Count] == quatType(7, 7, 7, 7) ? 0 : 1;
+
+		glm::slerpBatch(&A[0], &B[0], &Factors[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::slerp(A[i], B[i], Factors[i]), static_cast<T>(0.00001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_mat_cast()
+{
+	int Error = 0;
+
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4Type;
+	for(std::size_t Count = 0; Count <= MaxCount; ++Count)
+	{
+		std::vector<glm::qua<T, glm::defaultp> > In(Count, glm::qua<T, glm::defaultp>(1, 0, 0, 0));
+		std::vector<mat3Type> Out3(Count + 1, mat3Type(7));
+		std::vector<mat4Type> Out4(Count + 1, mat4Type(7));
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = sample<T>(i) * static_cast<T>(i % 2 ? 1 : 2);
+
+		glm::mat3CastBatch(In.empty() ? NULL : &In[0], &Out3[0], Count);
+		glm::mat4CastBatch(In.empty() ? NULL : &In[0], &Out4[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat3Type const Expected3 = glm::mat3_cast(In[i]);
+			mat4Type const Expected4 = glm::mat4_cast(In[i]);
+			for(glm::length_t c = 0; c < 3; ++c)
+				Error += glm::all(glm::equal(Out3[i][c], Expected3[c], static_cast<T>(0.00001))) ? 0 : 1;
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += glm::all(glm::equal(Out4[i][c], Expected4[c], static_cast<T>(0.00001))) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out3[Count][0], glm::vec<3, T, glm::defaultp>(7, 0, 0), static_cast<T>(0))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out4[Count][3], glm::vec<4, T, glm::defaultp>(0, 0, 0, 7), static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_dualquat_blend()
+{
+	int Error = 0;
+
+	typedef glm::tdualquat<T, glm::defaultp> dualquatType;
+	std::vector<dualquatType> Joints(8, dualquatType(glm::qua<T, glm::defaultp>(1, 0, 0, 0)));
+	for(std::size_t j = 0; j < Joints.size(); ++j)
+	{
+		T const t = static_cast<T>(j);
+		// half the joints stored with the opposite sign, the same rigid transform
+		glm::qua<T, glm::defaultp> const Real = sample<T>(j) * static_cast<T>(j % 2 ? -1 : 1);
+		Joints[j] = dualquatType(Real, glm::vec<3, T, glm::defaultp>(t, -t * static_cast<T>(0.5), static_cast<T>(2)));
+	}
+
+	std::size_t const Count = 19;
+	std::vector<glm::vec<4, int, glm::defaultp> > Indices(Count, glm::vec<4, int, glm::defaultp>(0));
+	std::vector<glm::vec<4, T, glm::defaultp> > Weights(Count, glm::vec<4, T, glm::defaultp>(0));
+	std::vector<dualquatType> Out(Count, dualquatType(glm::qua<T, glm::defaultp>(1, 0, 0, 0)));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Indices[i] = glm::vec<4, int, glm::defaultp>(static_cast<int>(i % 8), static_cast<int>((i + 1) % 8), static_cast<int>((i * 3) % 8), 0);
+		T const w = static_cast<T>(i % 4) * static_cast<T>(0.1);
+		Weights[i] = glm::vec<4, T, glm::defaultp>(static_cast<T>(0.5), static_cast<T>(0.5) - w, w, 0);
+	}
+
+	glm::dualquatBlendBatch(&Joints[0], &Indices[0], &Weights[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		// the same blend through the single dual quaternion operations
+		dualquatType const& First = Joints[Indices[i].x];
+		dualquatType Sum = First * Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			dualquatType const& Joint = Joints[Indices[i][k]];
+			Sum = Sum + Joint * (glm::dot(Joint.real, First.real) < static_cast<T>(0) ? -Weights[i][k] : Weights[i][k]);
+		}
+		dualquatType const Expected = glm::normalize(Sum);
+		Error += glm::all(glm::equal(Out[i].real, Expected.real, static_cast<T>(0.00001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[i].dual, Expected.dual, static_cast<T>(0.00001))) ? 0 : 1;
+		Error += glm::equal(glm::length(Out[i].real), static_cast<T>(1), static_cast<T>(0.00001)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_mul<float>();
+	Error += test_mul<double>();
+	Error += test_slerp<float>();
+	Error += test_slerp<double>();
+	Error += test_mat_cast<float>();
+	Error += test_mat_cast<double>();
+	Error += test_dualquat_blend<float>();
+	Error += test_dualquat_blend<double>();
+
+	return Error;
+}
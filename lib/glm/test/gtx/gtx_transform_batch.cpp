@@ -0,0 +1,145 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+
+// every length up to a few full AVX-512 registers, so each tail size is covered
+static std::size_t const MaxCount = 67;
+
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> transform()
+{
+	glm::mat<4, 4, T, glm::defaultp> const Projection = glm::perspective(static_cast<T>(0.7), static_cast<T>(1.5), static_cast<T>(0.1), static_cast<T>(100));
+	glm::mat<4, 4, T, glm::defaultp> const View = glm::rotate(glm::translate(glm::mat<4, 4, T, glm::defaultp>(1), glm::vec<3, T, glm::defaultp>(1, -2, -5)),
+		static_cast<T>(0.3), glm::vec<3, T, glm::defaultp>(0.2, 1, 0.1));
+	return Projection * View;
+}
+
+template<typename T>
+static glm::vec<4, T, glm::defaultp> sample(std::size_t i)
+{
+	T const t = static_cast<T>(i);
+	return glm::vec<4, T, glm::defaultp>(t * static_cast<T>(0.25) - 3, static_cast<T>(2) - t * static_cast<T>(0.125), t * static_cast<T>(0.5), i % 3 == 0 ? 1 : static_cast<T>(0.5));
+}
+
+template<typename T>
+static int test_aos()
+{
+	int Error = 0;
+
+	glm::mat<4, 4, T, glm::defaultp> const M = transform<T>();
+	for(std::size_t Count = 0; Count <= MaxCount; ++Count)
+	{
+		// one guard element past the end must be left alone
+		std::vector<glm::vec<4, T, glm::defaultp> > In(Count + 1), Out(Count + 1, glm::vec<4, T, glm::defaultp>(7));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+			In[i] = sample<T>(i);
+
+		glm::transformBatch(M, &In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], M * In[i], static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], glm::vec<4, T, glm::defaultp>(7), static_cast<T>(0))) ? 0 : 1;
+
+		// in place
+		glm::transformBatch(M, &In[0], &In[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(In[i], Out[i], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_soa()
+{
+	int Error = 0;
+
+	glm::mat<4, 4, T, glm::defaultp> const M = transform<T>();
+	for(std::size_t Count = 0; Count <= MaxCount; ++Count)
+	{
+		std::vector<T> X(Count + 1), Y(Count + 1), Z(Count + 1), W(Count + 1);
+		std::vector<T> OutX(Count + 1, 7), OutY(Count + 1, 7), OutZ(Count + 1, 7), OutW(Count + 1, 7);
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			glm::vec<4, T, glm::defaultp> const v = sample<T>(i);
+			X[i] = v.x; Y[i] = v.y; Z[i] = v.z; W[i] = v.w;
+		}
+
+		glm::transformBatch(M, &X[0], &Y[0], &Z[0], &W[0], &OutX[0], &OutY[0], &OutZ[0], &OutW[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec<4, T, glm::defaultp> const Expected = M * sample<T>(i);
+			glm::vec<4, T, glm::defaultp> const Result(OutX[i], OutY[i], OutZ[i], OutW[i]);
+			Error += glm::all(glm::equal(Result, Expected, static_cast<T>(0.0001))) ? 0 : 1;
+		}
+		Error += glm::equal(OutX[Count], static_cast<T>(7), static_cast<T>(0)) ? 0 : 1;
+		Error += glm::equal(OutW[Count], static_cast<T>(7), static_cast<T>(0)) ? 0 : 1;
+
+		// points, transformed in place
+		glm::transformPointBatch(M, &X[0], &Y[0], &Z[0], &X[0], &Y[0], &Z[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec<4, T, glm::defaultp> const v = sample<T>(i);
+			glm::vec<4, T, glm::defaultp> const Expected = M * glm::vec<4, T, glm::defaultp>(v.x, v.y, v.z, 1);
+			glm::vec<3, T, glm::defaultp> const Result(X[i], Y[i], Z[i]);
+			Error += glm::all(glm::equal(Result, glm::vec<3, T, glm::defaultp>(Expected), static_cast<T>(0.0001))) ? 0 : 1;
+		}
+		glm::vec<4, T, glm::defaultp> const Guard = sample<T>(Count);
+		Error += glm::equal(X[Count], Guard.x, static_cast<T>(0)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_inverse()
+{
+	int Error = 0;
+
+	typedef glm::mat<4, 4, T, glm::defaultp> matType;
+	for(std::size_t Count = 0; Count <= 19; ++Count)
+	{
+		std::vector<matType> In(Count + 1), Out(Count + 1, matType(7));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			T const t = static_cast<T>(i) * static_cast<T>(0.1);
+			In[i] = glm::scale(glm::rotate(glm::translate(matType(1), glm::vec<3, T, glm::defaultp>(t, 2, -t)), t, glm::vec<3, T, glm::defaultp>(0.6, 0, 0.8)),
+				glm::vec<3, T, glm::defaultp>(1 + t, 2, 0.5));
+			In[i][0][3] = t * static_cast<T>(0.05);
+		}
+
+		glm::inverseBatch(&In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			matType const Expected = glm::inverse(In[i]);
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += glm::all(glm::equal(Out[i][c], Expected[c], static_cast<T>(0.0001))) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out[Count][0], glm::vec<4, T, glm::defaultp>(7, 0, 0, 0), static_cast<T>(0))) ? 0 : 1;
+
+		// in place
+		glm::inverseBatch(&In[0], &In[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += glm::all(glm::equal(In[i][c], Out[i][c], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_aos<float>();
+	Error += test_aos<double>();
+	Error += test_soa<float>();
+	Error += test_soa<double>();
+	Error += test_inverse<float>();
+	Error += test_inverse<double>();
+
+	return Error;
+}
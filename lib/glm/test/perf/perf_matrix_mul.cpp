@@ -7,6 +7,7 @@
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
@@ -14,6 +15,17 @@
 #include <chrono>
 #include <cstdio>
 
+// SIMD products may sum in a different order, so results are compared in ULPs
+// rather than against an absolute tolerance that the larger samples exceed
+template <typename matType>
+static bool equal_ulps(matType const& A, matType const& B, int MaxULPs)
+{
+	for(glm::length_t i = 0; i < A.length(); ++i)
+		if(!glm::all(glm::equal(A[i], B[i], MaxULPs)))
+			return false;
+	return true;
+}
+
 template <typename matType>
 static void test_mat_mul_mat(matType const& M, std::vector<matType> const& I, std::vector<matType>& O)
 {
@@ -42,8 +54,6 @@ static int launch_mat_mul_mat(std::vector<matType>& O, matType const& Transform,
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat2_mul_mat2(std::size_t Samples)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4);
@@ -59,7 +69,7 @@ static int comp_mat2_mul_mat2(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		Error += equal_ulps(A, B, 4) ? 0 : 1;
 	}
 	
 	return Error;
@@ -68,8 +78,6 @@ static int comp_mat2_mul_mat2(std::size_t Samples)
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat3_mul_mat3(std::size_t Samples)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9);
@@ -85,7 +93,7 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		Error += equal_ulps(A, B, 4) ? 0 : 1;
 	}
 	
 	return Error;
@@ -94,8 +102,6 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 template <typename packedMatType, typename alignedMatType>
 static int comp_mat4_mul_mat4(std::size_t Samples)
 {
-	typedef typename packedMatType::value_type T;
-	
 	int Error = 0;
 
 	packedMatType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
@@ -111,7 +117,7 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	{
 		packedMatType const A = SISD[i];
 		packedMatType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		Error += equal_ulps(A, B, 4) ? 0 : 1;
 	}
 	
 	return Error;
@@ -0,0 +1,205 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/simd/batch.h>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Each 128 bit, 256 bit and 512 bit mat4 kernel built into this binary on a
+// working set that stays in cache, so the arithmetic is measured rather than
+// the memory bandwidth.
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static std::size_t const Samples = 1024;
+static int const Runs = 1000;
+
+static glm::aligned_mat4 sample(std::size_t i)
+{
+	float const f = static_cast<float>(i) * 0.01f + 0.1f;
+	return glm::aligned_mat4(glm::rotate(glm::translate(glm::mat4(1), glm::vec3(f, -f, 2.0f * f)), f, glm::vec3(0.267f, 0.534f, 0.802f)));
+}
+
+struct mul_scalar
+{
+	static void call(glm::mat4 const& a, glm::mat4 const& b, glm::mat4& out) { out = a * b; }
+};
+
+struct mul_sse
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const& b, glm::aligned_mat4& out) { glm_mat4_mul(&a[0].data, &b[0].data, &out[0].data); }
+};
+
+struct inverse_scalar
+{
+	static void call(glm::mat4 const& a, glm::mat4 const&, glm::mat4& out) { out = glm::inverse(a); }
+};
+
+struct inverse_sse
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const&, glm::aligned_mat4& out) { glm_mat4_inverse(&a[0].data, &out[0].data); }
+};
+
+struct transpose_scalar
+{
+	static void call(glm::mat4 const& a, glm::mat4 const&, glm::mat4& out) { out = glm::transpose(a); }
+};
+
+struct transpose_sse
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const&, glm::aligned_mat4& out) { glm_mat4_transpose(&a[0].data, &out[0].data); }
+};
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+struct mul_avx2
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const& b, glm::aligned_mat4& out) { glm_mat4_mul_avx2(&a[0].data, &b[0].data, &out[0].data); }
+};
+
+struct inverse_avx2
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const&, glm::aligned_mat4& out) { glm_mat4_inverse_avx2(&a[0].data, &out[0].data); }
+};
+#endif
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+struct mul_avx512
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const& b, glm::aligned_mat4& out) { glm_mat4_mul_avx512(&a[0].data, &b[0].data, &out[0].data); }
+};
+
+struct inverse_avx512
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const&, glm::aligned_mat4& out) { glm_mat4_inverse_avx512(&a[0].data, &out[0].data); }
+};
+
+struct transpose_avx512
+{
+	static void call(glm::aligned_mat4 const& a, glm::aligned_mat4 const&, glm::aligned_mat4& out) { glm_mat4_transpose_avx512(&a[0].data, &out[0].data); }
+};
+#endif
+
+// runs the kernel over the samples, returns the nanoseconds per matrix and counts results differing from Expected
+template<typename kernel, typename matType>
+static double launch(std::vector<glm::mat4> const& Expected, int& Error)
+{
+	std::vector<matType> A(Samples), B(Samples), O(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		A[i] = matType(sample(i));
+		B[i] = matType(sample(Samples - i));
+	}
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(int Run = 0; Run < Runs; ++Run)
+		for(std::size_t i = 0; i < Samples; ++i)
+			kernel::call(A[i], B[i], O[i]);
+	clock_type::time_point const t2 = clock_type::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(glm::mat4(O[i]), Expected[i], 0.0001f)) ? 0 : 1;
+
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count()) / static_cast<double>(Samples * Runs);
+}
+
+template<typename scalar>
+static std::vector<glm::mat4> expected()
+{
+	std::vector<glm::mat4> Result(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		scalar::call(glm::mat4(sample(i)), glm::mat4(sample(Samples - i)), Result[i]);
+	return Result;
+}
+
+template<typename kernel>
+static int report(char const* Name, std::vector<glm::mat4> const& Expected, double Baseline)
+{
+	int Error = 0;
+	double const Time = launch<kernel, glm::aligned_mat4>(Expected, Error);
+	std::printf("- %-7s %6.2f ns, %.2fx\n", Name, Time, Baseline / Time);
+	return Error;
+}
+
+// glm_mat4_inverse_batch over all the samples at once
+static int report_inverse_batch(std::vector<glm::mat4> const& Expected, double Baseline)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> A(Samples), O(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		A[i] = glm::mat4(sample(i));
+
+	clock_type::time_point const t1 = clock_type::now();
+	for(int Run = 0; Run < Runs; ++Run)
+		glm_mat4_inverse_batch(&A[0][0][0], &O[0][0][0], Samples);
+	clock_type::time_point const t2 = clock_type::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(O[i], Expected[i], 0.0001f)) ? 0 : 1;
+
+	double const Time = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count()) / static_cast<double>(Samples * Runs);
+	std::printf("- %-7s %6.2f ns, %.2fx\n", "batch", Time, Baseline / Time);
+	return Error;
+}
+
+template<typename scalar>
+static double baseline(char const* Name, std::vector<glm::mat4> const& Expected, int& Error)
+{
+	double const Time = launch<scalar, glm::mat4>(Expected, Error);
+	std::printf("%s:\n- %-7s %6.2f ns\n", Name, "scalar", Time);
+	return Time;
+}
+
+int main()
+{
+	int Error = 0;
+
+	{
+		std::vector<glm::mat4> const Expected = expected<mul_scalar>();
+		double const Baseline = baseline<mul_scalar>("mat4 * mat4", Expected, Error);
+		Error += report<mul_sse>("sse", Expected, Baseline);
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			Error += report<mul_avx2>("avx2", Expected, Baseline);
+#		endif
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			Error += report<mul_avx512>("avx512", Expected, Baseline);
+#		endif
+	}
+
+	{
+		std::vector<glm::mat4> const Expected = expected<inverse_scalar>();
+		double const Baseline = baseline<inverse_scalar>("inverse(mat4)", Expected, Error);
+		Error += report<inverse_sse>("sse", Expected, Baseline);
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			Error += report<inverse_avx2>("avx2", Expected, Baseline);
+#		endif
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			Error += report<inverse_avx512>("avx512", Expected, Baseline);
+#		endif
+		Error += report_inverse_batch(Expected, Baseline);
+	}
+
+	{
+		std::vector<glm::mat4> const Expected = expected<transpose_scalar>();
+		double const Baseline = baseline<transpose_scalar>("transpose(mat4)", Expected, Error);
+		Error += report<transpose_sse>("sse", Expected, Baseline);
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			Error += report<transpose_avx512>("avx512", Expected, Baseline);
+#		endif
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
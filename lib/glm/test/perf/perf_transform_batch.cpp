@@ -0,0 +1,111 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+static double elapsed_us(clock_type::time_point t1, clock_type::time_point t2)
+{
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count()) / 1000.0;
+}
+
+// bytes read and written per microsecond is MB/s
+static void report(char const* Name, double Time, std::size_t Samples, std::size_t Bytes)
+{
+	std::printf("- %s: %.0f us, %.1f Mvec/s, %.2f GB/s\n", Name, Time, Samples / Time, Bytes / Time / 1000.0);
+}
+
+static int comp_aos(std::size_t Samples, int Runs)
+{
+	int Error = 0;
+
+	glm::mat4 const Transform = glm::rotate(glm::translate(glm::mat4(1), glm::vec3(1, 2, 3)), 0.5f, glm::vec3(0, 0, 1));
+	std::vector<glm::vec4> I(Samples), SISD(Samples), Batch(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = glm::vec4(0.01f, 0.02f, 0.03f, 1.0f) * static_cast<float>(i % 1000);
+
+	double TimeSISD = 0, TimeBatch = 0;
+	for(int Run = 0; Run < Runs; ++Run)
+	{
+		clock_type::time_point t0 = clock_type::now();
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = Transform * I[i];
+		clock_type::time_point t1 = clock_type::now();
+		glm::transformBatch(Transform, &I[0], &Batch[0], Samples);
+		clock_type::time_point t2 = clock_type::now();
+		TimeSISD += elapsed_us(t0, t1);
+		TimeBatch += elapsed_us(t1, t2);
+	}
+	report("mat4 * vec4 loop ", TimeSISD / Runs, Samples, Samples * 32);
+	report("transformBatch   ", TimeBatch / Runs, Samples, Samples * 32);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_soa(std::size_t Samples, int Runs)
+{
+	int Error = 0;
+
+	glm::mat4 const Transform = glm::rotate(glm::translate(glm::mat4(1), glm::vec3(1, 2, 3)), 0.5f, glm::vec3(0, 0, 1));
+	std::vector<float> X(Samples), Y(Samples), Z(Samples), OutX(Samples), OutY(Samples), OutZ(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = 0.01f * static_cast<float>(i % 1000);
+		Y[i] = 0.02f * static_cast<float>(i % 1000);
+		Z[i] = 0.03f * static_cast<float>(i % 1000);
+	}
+
+	double Time = 0;
+	for(int Run = 0; Run < Runs; ++Run)
+	{
+		clock_type::time_point t0 = clock_type::now();
+		glm::transformPointBatch(Transform, &X[0], &Y[0], &Z[0], &OutX[0], &OutY[0], &OutZ[0], Samples);
+		clock_type::time_point t1 = clock_type::now();
+		Time += elapsed_us(t0, t1);
+	}
+	report("transformPointBatch", Time / Runs, Samples, Samples * 24);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec4 const Expected = Transform * glm::vec4(X[i], Y[i], Z[i], 1.0f);
+		Error += glm::all(glm::equal(glm::vec3(Expected), glm::vec3(OutX[i], OutY[i], OutZ[i]), 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	// in cache, then streaming from memory
+	std::size_t const Sizes[2] = {16384, 1 << 22};
+	int const Runs[2] = {100, 4};
+	for(int s = 0; s < 2; ++s)
+	{
+		std::printf("%d vectors:\n", static_cast<int>(Sizes[s]));
+		Error += comp_aos(Sizes[s], Runs[s]);
+		Error += comp_soa(Sizes[s], Runs[s]);
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
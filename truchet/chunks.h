@@ -0,0 +1,527 @@
+#ifndef CHUNKS_H
+#define CHUNKS_H
+
+#include <glad/glad.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <tiles.h>
+#include <program_cache.h>
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+// Streaming truchet plane for boards too large to keep resident.
+//
+// Tiles are never stored: each tile's orientation and colour come from a hash
+// of its (i, j) index, so any part of an unbounded plane can be regenerated on
+// demand. The plane is split into chunks of CHUNK_TILES x CHUNK_TILES tiles,
+// grouped into a quadtree where a node at level L covers 2^L x 2^L chunks.
+//
+// Each frame the quadtree is walked over the camera's footprint: nodes outside
+// the view frustum are culled, nodes that would show their texture larger than
+// about one texel per pixel are split, and what is left is drawn either as
+// full tile geometry (level 0 nodes close to the camera) or as one textured
+// quad with the pattern baked into a layer of a texture array. Both kinds of
+// data live in fixed size pools, recycled least recently used first, and only
+// a few entries are generated per frame so the frame cost stays bounded
+// however far the camera moves or zooms out. Nodes still waiting for data are
+// drawn from a flat average colour.
+//
+// Positions are kept relative to the camera (in double on the CPU) so the
+// plane stays precise millions of tiles from the origin.
+
+#define CHUNK_TILES               32      // tiles along a chunk side
+#define CHUNK_SLOTS               256     // chunks of tile geometry resident on the GPU
+#define LOD_TEXELS                128     // texture size of one LOD node
+#define LOD_LAYERS                512     // LOD textures resident on the GPU
+#define CHUNK_UPLOADS_PER_FRAME   8
+#define LOD_UPLOADS_PER_FRAME     16
+#define GEOMETRY_DISTANCE_CHUNKS  2.5f    // level 0 nodes nearer than this many chunk widths draw tiles
+#define LOD_MAX_LEVEL             20
+
+// Whether point (u, v) of a tile's top face, both in [-1, 1], lies on the on
+// triangle. Unrotated, the on triangle is the upper left half (v > u); a flip
+// about y mirrors u and a flip about x mirrors v.
+inline bool tile_on_at(float u, float v, bool flip_x, bool flip_y)
+{
+    return (flip_y ? -v : v) > (flip_x ? -u : u);
+}
+
+// Frustum planes (normal.xyz, d) of a clip matrix, inside where dot >= 0
+struct frustum {
+    glm::vec4 planes[6];
+
+    explicit frustum(const glm::mat4 &clip)
+    {
+        glm::vec4 row[4];
+        for (int r = 0; r < 4; r++) {
+            row[r] = glm::vec4(clip[0][r], clip[1][r], clip[2][r], clip[3][r]);
+        }
+        planes[0] = row[3] + row[0];
+        planes[1] = row[3] - row[0];
+        planes[2] = row[3] + row[1];
+        planes[3] = row[3] - row[1];
+        planes[4] = row[3] + row[2];
+        planes[5] = row[3] - row[2];
+    }
+
+    // false only if the box is entirely outside one plane
+    bool intersects(const glm::vec3 &lo, const glm::vec3 &hi) const
+    {
+        for (int k = 0; k < 6; k++) {
+            const glm::vec4 &p = planes[k];
+            glm::vec3 far_corner(p.x >= 0.0f ? hi.x : lo.x, p.y >= 0.0f ? hi.y : lo.y, p.z >= 0.0f ? hi.z : lo.z);
+            if (glm::dot(glm::vec3(p), far_corner) + p.w < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+class TileStreamer
+{
+public:
+    // world size of one tile and its thickness, as in the fixed board
+    float    tile_space;
+    float    tile_depth;
+    uint32_t seed;
+
+    // camera: position over the plane in world units (double so far away
+    // chunks stay precise), height above it and tilt from straight down
+    double cam_x, cam_y;
+    float  cam_height;
+    float  cam_pitch;
+
+    // counters for the last frame
+    int nodes_drawn, chunks_drawn, uploads;
+
+    // mesh_vbo/mesh_ebo hold the tile mesh used by tile_program (position and
+    // face class per vertex, see truchet.cpp); the streamer supplies the per
+    // tile attributes 2-7 from its own pool
+    TileStreamer(unsigned int mesh_vbo, unsigned int mesh_ebo, unsigned int mesh_index_count,
+                 unsigned int tile_program, float tile_space_, float tile_depth_, uint32_t seed_)
+        : tile_space(tile_space_), tile_depth(tile_depth_), seed(seed_),
+          cam_x(0.0), cam_y(0.0), cam_height(3.0f), cam_pitch(glm::radians(35.0f)),
+          nodes_drawn(0), chunks_drawn(0), uploads(0),
+          index_count(mesh_index_count), program(tile_program), frame_count(0),
+          chunk_slots(CHUNK_SLOTS), lod_layers(LOD_LAYERS)
+    {
+        chunk_offset_location = glGetUniformLocation(program, "chunkOffset");
+
+        // tile geometry: the shared mesh plus per tile attributes from the slot pool
+        glGenVertexArrays(1, &vao_tiles);
+        glGenBuffers(1, &vbo_position);
+        glGenBuffers(1, &vbo_state);
+        glGenBuffers(3, vbo_colour);
+
+        glBindVertexArray(vao_tiles);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh_vbo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh_ebo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        for (int attrib = 2; attrib <= 7; attrib++) {
+            glEnableVertexAttribArray(attrib);
+            glVertexAttribDivisor(attrib, 1);
+        }
+        glBindVertexArray(0);
+
+        size_t pool_tiles = (size_t)CHUNK_SLOTS * tiles_per_chunk;
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_position);
+        glBufferData(GL_ARRAY_BUFFER, pool_tiles * sizeof(glm::vec3), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_state);
+        glBufferData(GL_ARRAY_BUFFER, pool_tiles * sizeof(struct tile_state), NULL, GL_DYNAMIC_DRAW);
+        for (int k = 0; k < 3; k++) {
+            glBindBuffer(GL_ARRAY_BUFFER, vbo_colour[k]);
+            glBufferData(GL_ARRAY_BUFFER, pool_tiles * sizeof(glm::vec3), NULL, GL_DYNAMIC_DRAW);
+        }
+
+        // LOD quads: one instance per node, corner and size relative to the camera plus texture layer
+        lod_program = build_lod_program();
+        glGenVertexArrays(1, &vao_lod);
+        glGenBuffers(1, &vbo_lod);
+        glBindVertexArray(vao_lod);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_lod);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(struct lod_instance), (void*)offsetof(struct lod_instance, rect));
+        glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, sizeof(struct lod_instance), (void*)offsetof(struct lod_instance, layer));
+        for (int attrib = 0; attrib <= 1; attrib++) {
+            glEnableVertexAttribArray(attrib);
+            glVertexAttribDivisor(attrib, 1);
+        }
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        glGenTextures(1, &lod_texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, lod_texture);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, LOD_TEXELS, LOD_TEXELS, LOD_LAYERS, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+        texels.resize(LOD_TEXELS * LOD_TEXELS * 4);
+        chunk_position.resize(tiles_per_chunk);
+        chunk_state.resize(tiles_per_chunk);
+        chunk_colour[0].resize(tiles_per_chunk);
+        chunk_colour[1].assign(tiles_per_chunk, tile_colour_off);
+        chunk_colour[2].assign(tiles_per_chunk, tile_colour_edge);
+    }
+    ~TileStreamer()
+    {
+        glDeleteVertexArrays(1, &vao_tiles);
+        glDeleteVertexArrays(1, &vao_lod);
+        glDeleteBuffers(1, &vbo_position);
+        glDeleteBuffers(1, &vbo_state);
+        glDeleteBuffers(3, vbo_colour);
+        glDeleteBuffers(1, &vbo_lod);
+        glDeleteTextures(1, &lod_texture);
+        glDeleteProgram(lod_program);
+    }
+    TileStreamer(const TileStreamer &) = delete;
+    TileStreamer &operator=(const TileStreamer &) = delete;
+
+    // move the camera by a fraction of its height, so panning feels the same at any zoom
+    void pan(float dx, float dy)
+    {
+        cam_x += (double)dx * cam_height;
+        cam_y += (double)dy * cam_height;
+    }
+
+    void zoom(float factor)
+    {
+        cam_height = glm::clamp(cam_height * factor, 0.3f, 20000.0f);
+    }
+
+    // switch to another plane, dropping everything generated from the old seed
+    void reseed(uint32_t seed_)
+    {
+        seed = seed_;
+        chunk_slots = pool(CHUNK_SLOTS);
+        lod_layers  = pool(LOD_LAYERS);
+    }
+
+    // camera relative view and a projection whose depth range follows the height
+    glm::mat4 view() const
+    {
+        glm::vec3 eye(0.0f, 0.0f, cam_height);
+        glm::vec3 centre(0.0f, cam_height * tanf(cam_pitch), 0.0f);
+        return glm::lookAt(eye, centre, glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+
+    glm::mat4 projection(float aspect) const
+    {
+        return glm::perspective(glm::radians(40.0f), aspect, 0.05f * cam_height, 60.0f * cam_height);
+    }
+
+    // select, stream and draw the visible part of the plane; the Frame block
+    // must already hold view() and projection() for this frame
+    void draw(const glm::mat4 &view, const glm::mat4 &projection, int viewport_height)
+    {
+        frame_count++;
+        nodes_drawn = chunks_drawn = uploads = 0;
+        chunk_budget = CHUNK_UPLOADS_PER_FRAME;
+        lod_budget   = LOD_UPLOADS_PER_FRAME;
+        near_chunks.clear();
+        lod_instances.clear();
+
+        frustum view_frustum(projection * view);
+        pixels_per_radian = projection[1][1] * viewport_height / 2.0f;
+
+        // roots: the coarsest nodes around the camera covering the far plane
+        double far_distance = 60.0 * cam_height;
+        double chunk_world  = CHUNK_TILES * (double)tile_space;
+        int level = 0;
+        while (level < LOD_MAX_LEVEL && chunk_world * (1 << level) < far_distance / 2.0) {
+            level++;
+        }
+        double node_world = chunk_world * (1 << level);
+        int x0 = (int)floor((cam_x - far_distance) / node_world);
+        int x1 = (int)floor((cam_x + far_distance) / node_world);
+        int y0 = (int)floor((cam_y - far_distance) / node_world);
+        int y1 = (int)floor((cam_y + far_distance) / node_world);
+        for (int ny = y0; ny <= y1; ny++) {
+            for (int nx = x0; nx <= x1; nx++) {
+                visit(view_frustum, level, nx, ny);
+            }
+        }
+
+        // near chunks as tile geometry with the caller's tile program
+        glUseProgram(program);
+        glBindVertexArray(vao_tiles);
+        for (size_t n = 0; n < near_chunks.size(); n++) {
+            draw_chunk(near_chunks[n]);
+        }
+        glBindVertexArray(0);
+
+        // everything else as textured quads in one call
+        if (!lod_instances.empty()) {
+            glUseProgram(lod_program);
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, lod_texture);
+            glBindBuffer(GL_ARRAY_BUFFER, vbo_lod);
+            glBufferData(GL_ARRAY_BUFFER, lod_instances.size() * sizeof(struct lod_instance), lod_instances.data(), GL_STREAM_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindVertexArray(vao_lod);
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, lod_instances.size());
+            glBindVertexArray(0);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        }
+        nodes_drawn = lod_instances.size();
+        chunks_drawn = near_chunks.size();
+    }
+
+private:
+    struct near_chunk {
+        int slot;
+        int cx, cy;
+    };
+
+    struct lod_instance {
+        glm::vec4 rect;     // corner relative to the camera and size, in world units
+        float     layer;    // texture layer, negative for the flat fallback colour
+    };
+
+    // least recently used pool of GPU entries keyed by node
+    struct pool {
+        std::unordered_map<uint64_t, int> slot_of;
+        std::vector<uint64_t> key;
+        std::vector<long>     last_used;
+
+        explicit pool(int size) : key(size, 0), last_used(size, -1) {}
+
+        int find(uint64_t k, long frame)
+        {
+            std::unordered_map<uint64_t, int>::iterator it = slot_of.find(k);
+            if (it == slot_of.end()) {
+                return -1;
+            }
+            last_used[it->second] = frame;
+            return it->second;
+        }
+
+        // reuse the least recently used entry, or -1 if all are in use this frame
+        int claim(uint64_t k, long frame)
+        {
+            int slot = std::min_element(last_used.begin(), last_used.end()) - last_used.begin();
+            if (last_used[slot] == frame) {
+                return -1;
+            }
+            if (last_used[slot] >= 0) {
+                slot_of.erase(key[slot]);
+            }
+            key[slot] = k;
+            last_used[slot] = frame;
+            slot_of[k] = slot;
+            return slot;
+        }
+    };
+
+    static const int tiles_per_chunk = CHUNK_TILES * CHUNK_TILES;
+
+    unsigned int index_count;
+    unsigned int program, lod_program;
+    int          chunk_offset_location;
+    unsigned int vao_tiles, vbo_position, vbo_state, vbo_colour[3];
+    unsigned int vao_lod, vbo_lod, lod_texture;
+
+    long frame_count;
+    pool chunk_slots, lod_layers;
+    int  chunk_budget, lod_budget;
+    float pixels_per_radian;
+
+    std::vector<struct near_chunk>   near_chunks;
+    std::vector<struct lod_instance> lod_instances;
+
+    std::vector<unsigned char>     texels;
+    std::vector<glm::vec3>         chunk_position;
+    std::vector<struct tile_state> chunk_state;
+    std::vector<glm::vec3>         chunk_colour[3];
+
+    static uint64_t node_key(int level, int nx, int ny)
+    {
+        // unique while |nx|, |ny| < 2^28, far beyond what the camera can reach
+        return ((uint64_t)level << 58) | ((uint64_t)((uint32_t)nx & 0x1fffffffu) << 29) | ((uint32_t)ny & 0x1fffffffu);
+    }
+
+    void visit(const frustum &view_frustum, int level, int nx, int ny)
+    {
+        double node_world = CHUNK_TILES * (double)tile_space * (1 << level);
+        glm::vec3 lo((float)(nx * node_world - cam_x), (float)(ny * node_world - cam_y), -tile_depth);
+        glm::vec3 hi(lo.x + (float)node_world, lo.y + (float)node_world, tile_depth);
+        if (!view_frustum.intersects(lo, hi)) {
+            return;
+        }
+
+        // distance from the camera to the nearest point of the node
+        glm::vec3 nearest = glm::clamp(glm::vec3(0.0f, 0.0f, cam_height), lo, hi);
+        float distance = std::max(glm::length(nearest - glm::vec3(0.0f, 0.0f, cam_height)), 1.0e-3f);
+
+        if (level > 0 && node_world / distance * pixels_per_radian > 1.5f * LOD_TEXELS) {
+            for (int k = 0; k < 4; k++) {
+                visit(view_frustum, level - 1, 2 * nx + (k & 1), 2 * ny + (k >> 1));
+            }
+            return;
+        }
+
+        if (level == 0 && distance < GEOMETRY_DISTANCE_CHUNKS * node_world) {
+            uint64_t key = node_key(0, nx, ny);
+            int slot = chunk_slots.find(key, frame_count);
+            if (slot < 0 && chunk_budget > 0 && (slot = chunk_slots.claim(key, frame_count)) >= 0) {
+                chunk_budget--;
+                upload_chunk(slot, nx, ny);
+            }
+            if (slot >= 0) {
+                struct near_chunk chunk = { slot, nx, ny };
+                near_chunks.push_back(chunk);
+                return;
+            }
+        }
+
+        uint64_t key = node_key(level, nx, ny);
+        int layer = lod_layers.find(key, frame_count);
+        if (layer < 0 && lod_budget > 0 && (layer = lod_layers.claim(key, frame_count)) >= 0) {
+            lod_budget--;
+            upload_lod(layer, level, nx, ny);
+        }
+        struct lod_instance instance;
+        instance.rect  = glm::vec4(lo.x, lo.y, (float)node_world, tile_depth / 2.0f);
+        instance.layer = (float)layer;
+        lod_instances.push_back(instance);
+    }
+
+    // generate the tiles of chunk (cx, cy) into a pool slot, positions
+    // relative to the chunk's corner
+    void upload_chunk(int slot, int cx, int cy)
+    {
+        for (int jj = 0; jj < CHUNK_TILES; jj++) {
+            for (int ii = 0; ii < CHUNK_TILES; ii++) {
+                int t = ii * CHUNK_TILES + jj;
+                struct tile_pattern p = tile_pattern_at(cx * CHUNK_TILES + ii, cy * CHUNK_TILES + jj, seed);
+                glm::vec2 rotation(p.flip_x ? 180.0f : 0.0f, p.flip_y ? 180.0f : 0.0f);
+                chunk_position[t] = glm::vec3((ii + 0.5f) * tile_space, (jj + 0.5f) * tile_space, 0.0f);
+                chunk_state[t].rotation_from   = rotation;
+                chunk_state[t].target_rotation = rotation;
+                chunk_state[t].rotation_start  = 0.0f;
+                chunk_state[t].bump_start      = -1.0e30f;
+                chunk_colour[0][t] = p.colour_on;
+            }
+        }
+        size_t first = (size_t)slot * tiles_per_chunk;
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_position);
+        glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(glm::vec3), tiles_per_chunk * sizeof(glm::vec3), chunk_position.data());
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_state);
+        glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(struct tile_state), tiles_per_chunk * sizeof(struct tile_state), chunk_state.data());
+        for (int k = 0; k < 3; k++) {
+            glBindBuffer(GL_ARRAY_BUFFER, vbo_colour[k]);
+            glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(glm::vec3), tiles_per_chunk * sizeof(glm::vec3), chunk_colour[k].data());
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        uploads++;
+    }
+
+    // bake node (level, nx, ny) into a texture layer, one point sample per texel
+    void upload_lod(int layer, int level, int nx, int ny)
+    {
+        double tiles_across = (double)CHUNK_TILES * (1 << level);
+        double base_i = nx * tiles_across;
+        double base_j = ny * tiles_across;
+        for (int py = 0; py < LOD_TEXELS; py++) {
+            double tj = base_j + (py + 0.5) * tiles_across / LOD_TEXELS;
+            int    j  = (int)floor(tj);
+            float  v  = (float)(2.0 * (tj - j) - 1.0);
+            for (int px = 0; px < LOD_TEXELS; px++) {
+                double ti = base_i + (px + 0.5) * tiles_across / LOD_TEXELS;
+                int    i  = (int)floor(ti);
+                float  u  = (float)(2.0 * (ti - i) - 1.0);
+                struct tile_pattern p = tile_pattern_at(i, j, seed);
+                glm::vec3 c = tile_on_at(u, v, p.flip_x, p.flip_y) ? p.colour_on : tile_colour_off;
+                unsigned char *texel = &texels[(py * LOD_TEXELS + px) * 4];
+                texel[0] = (unsigned char)(255.0f * c.r);
+                texel[1] = (unsigned char)(255.0f * c.g);
+                texel[2] = (unsigned char)(255.0f * c.b);
+                texel[3] = 255;
+            }
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, lod_texture);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, LOD_TEXELS, LOD_TEXELS, 1, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        uploads++;
+    }
+
+    // point the per tile attributes at a pool slot and draw its tiles
+    void draw_chunk(const struct near_chunk &chunk)
+    {
+        size_t first = (size_t)chunk.slot * tiles_per_chunk;
+        double chunk_world = CHUNK_TILES * (double)tile_space;
+        glUniform3f(chunk_offset_location, (float)(chunk.cx * chunk_world - cam_x),
+                    (float)(chunk.cy * chunk_world - cam_y), 0.0f);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_position);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)(first * sizeof(glm::vec3)));
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_state);
+        glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(struct tile_state),
+                              (void*)(first * sizeof(struct tile_state) + offsetof(struct tile_state, rotation_from)));
+        glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(struct tile_state),
+                              (void*)(first * sizeof(struct tile_state) + offsetof(struct tile_state, rotation_start)));
+        for (int k = 0; k < 3; k++) {
+            glBindBuffer(GL_ARRAY_BUFFER, vbo_colour[k]);
+            glVertexAttribPointer(5 + k, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)(first * sizeof(glm::vec3)));
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDrawElementsInstanced(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, 0, tiles_per_chunk);
+    }
+
+    static unsigned int build_lod_program()
+    {
+        static const char *vertex_source = "#version 330 core\n"
+            "layout (location = 0) in vec4 aRect;\n"
+            "layout (location = 1) in float aLayer;\n"
+            "layout (std140) uniform Frame {\n"
+            "   mat4 view;\n"
+            "   mat4 projection;\n"
+            "};\n"
+            "out vec2 uv;\n"
+            "flat out float layer;\n"
+            "void main()\n"
+            "{\n"
+            "   uv = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+            "   layer = aLayer;\n"
+            "   gl_Position = projection * view * vec4(aRect.xy + uv * aRect.z, aRect.w, 1.0);\n"
+            "}\0";
+        static const char *fragment_source = "#version 330 core\n"
+            "uniform sampler2DArray pattern;\n"
+            "in vec2 uv;\n"
+            "flat in float layer;\n"
+            "out vec4 FragColor;\n"
+            "void main()\n"
+            "{\n"
+            "   FragColor = layer < 0.0 ? vec4(1.0, 0.625, 0.625, 1.0) : texture(pattern, vec3(uv, layer));\n"
+            "}\0";
+
+        std::vector<ProgramStage> stages;
+        stages.push_back(ProgramStage(GL_VERTEX_SHADER, vertex_source));
+        stages.push_back(ProgramStage(GL_FRAGMENT_SHADER, fragment_source));
+        unsigned int lod = ProgramCache::shared().build(stages, "LOD");
+
+        unsigned int block = glGetUniformBlockIndex(lod, "Frame");
+        if (block != GL_INVALID_INDEX) {
+            glUniformBlockBinding(lod, block, 0);
+        }
+        glUseProgram(lod);
+        glUniform1i(glGetUniformLocation(lod, "pattern"), 0);
+        glUseProgram(0);
+        return lod;
+    }
+};
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef PICKING_H
+#define PICKING_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <tiles.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Cursor to tile picking for a TileStore.
+//
+// The cursor is unprojected into a world space ray with glm::unProject and
+// walked through a uniform grid over the board. Every cell lists the tiles
+// whose bounding box overlaps it; the box bounds the tile's bounding sphere at
+// rest height, so it holds for any rotation and the grid only needs building
+// once. The few tiles still bumped up (TileStore::raised, plus the held tile)
+// are tested on their own. Candidates are rejected against their bounding
+// sphere, then tested exactly against the tile's rotated, bumped box at the
+// current time, and the walk stops as soon as a hit is nearer than the next
+// cell, so a query touches a handful of cells whatever the size of the board.
+//
+// The triangle BVH in GTX_intersect is not used here: tiles sit on a regular
+// grid and are tested as boxes rather than triangles, which the grid walk
+// already handles with no tree to build or refit as tiles move.
+class TilePicker
+{
+public:
+    struct ray {
+        glm::vec3 origin;
+        glm::vec3 direction;
+    };
+
+    // tile positions must not change after construction
+    TilePicker(const TileStore &tiles, float tile_width, float tile_depth)
+        : store(tiles), width(tile_width), depth(tile_depth)
+    {
+        radius = sqrtf(width * width / 2.0f + depth * depth / 4.0f);
+        build();
+    }
+
+    // ray under the cursor; cursor is in window coordinates (origin top left)
+    // which may differ from framebuffer pixels on high DPI displays
+    static struct ray cursor_ray(double cursor_x, double cursor_y, int window_width, int window_height,
+                                 int framebuffer_width, int framebuffer_height,
+                                 const glm::mat4 &view, const glm::mat4 &projection)
+    {
+        float x = (float)(cursor_x * framebuffer_width / window_width);
+        float y = (float)(framebuffer_height - cursor_y * framebuffer_height / window_height);
+        glm::vec4 viewport(0.0f, 0.0f, (float)framebuffer_width, (float)framebuffer_height);
+        glm::vec3 near_point = glm::unProject(glm::vec3(x, y, 0.0f), view, projection, viewport);
+        glm::vec3 far_point  = glm::unProject(glm::vec3(x, y, 1.0f), view, projection, viewport);
+        struct ray r = { near_point, far_point - near_point };
+        return r;
+    }
+
+    // nearest tile hit by the ray at time now, or -1; held_tile is drawn at
+    // full bump height (the highlighted tile), -1 for none
+    int pick(const struct ray &r, float now, int held_tile = -1) const
+    {
+        int   best   = -1;
+        float best_t = std::numeric_limits<float>::max();
+        float hit;
+        for (size_t n = 0; n <= store.raised.size(); n++) {
+            int t = (n < store.raised.size()) ? (int)store.raised[n] : held_tile;
+            if (t >= 0 && hit_tile(r, t, now, t == held_tile, hit) && hit < best_t) {
+                best_t = hit;
+                best   = t;
+            }
+        }
+
+        // clip the ray to the grid's box
+        float t0 = 0.0f, t1 = std::numeric_limits<float>::max();
+        if (!slab(r.origin, r.direction, glm::vec3(grid_min, z_min), glm::vec3(grid_max, z_max), t0, t1)) {
+            return best;
+        }
+
+        // walk the cells along the ray (Amanatides & Woo)
+        glm::vec3 start = r.origin + t0 * r.direction;
+        int cx = glm::clamp((int)floor((start.x - grid_min.x) / cell), 0, cells_x - 1);
+        int cy = glm::clamp((int)floor((start.y - grid_min.y) / cell), 0, cells_y - 1);
+        int step_x = r.direction.x >= 0.0f ? 1 : -1;
+        int step_y = r.direction.y >= 0.0f ? 1 : -1;
+        float inf = std::numeric_limits<float>::max();
+        float delta_x = r.direction.x != 0.0f ? cell / fabsf(r.direction.x) : inf;
+        float delta_y = r.direction.y != 0.0f ? cell / fabsf(r.direction.y) : inf;
+        float next_x = r.direction.x != 0.0f ? (grid_min.x + (cx + (step_x > 0)) * cell - r.origin.x) / r.direction.x : inf;
+        float next_y = r.direction.y != 0.0f ? (grid_min.y + (cy + (step_y > 0)) * cell - r.origin.y) / r.direction.y : inf;
+
+        while (true) {
+            unsigned int c = cy * cells_x + cx;
+            for (unsigned int k = cell_start[c]; k < cell_start[c + 1]; k++) {
+                unsigned int t = cell_items[k];
+                if (hit_tile(r, t, now, (int)t == held_tile, hit) && hit < best_t) {
+                    best_t = hit;
+                    best   = t;
+                }
+            }
+            float cell_exit = std::min(std::min(next_x, next_y), t1);
+            if (best_t <= cell_exit || cell_exit >= t1) {
+                break;
+            }
+            if (next_x < next_y) {
+                cx += step_x;
+                next_x += delta_x;
+            } else {
+                cy += step_y;
+                next_y += delta_y;
+            }
+            if (cx < 0 || cx >= cells_x || cy < 0 || cy >= cells_y) {
+                break;
+            }
+        }
+        return best;
+    }
+
+private:
+    const TileStore &store;
+    float width, depth, radius;
+
+    glm::vec2 grid_min, grid_max;
+    float     z_min, z_max;
+    float     cell;
+    int       cells_x, cells_y;
+    std::vector<unsigned int> cell_start;   // cell c lists cell_items[cell_start[c] .. cell_start[c + 1])
+    std::vector<unsigned int> cell_items;
+
+    // bounding box of a tile at rest height in any orientation
+    void bounds(unsigned int t, glm::vec3 &lo, glm::vec3 &hi) const
+    {
+        lo = store.position[t] - glm::vec3(radius);
+        hi = store.position[t] + glm::vec3(radius);
+    }
+
+    // grid with one cell per tile spacing, filled in two passes (count, then place)
+    void build()
+    {
+        unsigned int n = store.size();
+        glm::vec3 lo(std::numeric_limits<float>::max()), hi(-std::numeric_limits<float>::max());
+        for (unsigned int t = 0; t < n; t++) {
+            glm::vec3 a, b;
+            bounds(t, a, b);
+            lo = glm::min(lo, a);
+            hi = glm::max(hi, b);
+        }
+        grid_min = glm::vec2(lo);
+        grid_max = glm::vec2(hi);
+        z_min = lo.z;
+        z_max = hi.z;
+        cell    = std::max(width, 1.0e-6f);
+        cells_x = std::max(1, (int)ceil((grid_max.x - grid_min.x) / cell));
+        cells_y = std::max(1, (int)ceil((grid_max.y - grid_min.y) / cell));
+
+        std::vector<unsigned int> count(cells_x * cells_y + 1, 0);
+        for (int pass = 0; pass < 2; pass++) {
+            for (unsigned int t = 0; t < n; t++) {
+                glm::vec3 a, b;
+                bounds(t, a, b);
+                int x0 = glm::clamp((int)floor((a.x - grid_min.x) / cell), 0, cells_x - 1);
+                int x1 = glm::clamp((int)floor((b.x - grid_min.x) / cell), 0, cells_x - 1);
+                int y0 = glm::clamp((int)floor((a.y - grid_min.y) / cell), 0, cells_y - 1);
+                int y1 = glm::clamp((int)floor((b.y - grid_min.y) / cell), 0, cells_y - 1);
+                for (int y = y0; y <= y1; y++) {
+                    for (int x = x0; x <= x1; x++) {
+                        unsigned int c = y * cells_x + x;
+                        if (pass == 0) {
+                            count[c]++;
+                        } else {
+                            cell_items[--count[c]] = t;
+                        }
+                    }
+                }
+            }
+            if (pass == 0) {
+                // prefix sums: count[c] becomes the end of cell c, filled backwards in pass 1
+                cell_start.assign(cells_x * cells_y + 1, 0);
+                for (int c = 0; c < cells_x * cells_y; c++) {
+                    cell_start[c + 1] = cell_start[c] + count[c];
+                    count[c] = cell_start[c + 1];
+                }
+                cell_items.resize(cell_start.back());
+            }
+        }
+    }
+
+    // ray against the tile's box as drawn at time now; hit is the entry distance
+    bool hit_tile(const struct ray &r, unsigned int t, float now, bool held, float &hit) const
+    {
+        float z = held ? store.bump_height : store.bump(t, now);
+        glm::vec3 centre = store.position[t] + glm::vec3(0.0f, 0.0f, z);
+
+        // bounding sphere first, it needs no trigonometry
+        glm::vec3 to_centre = centre - r.origin;
+        float along = glm::dot(to_centre, r.direction);
+        float length2 = glm::dot(r.direction, r.direction);
+        if (glm::dot(to_centre, to_centre) * length2 - along * along > radius * radius * length2) {
+            return false;
+        }
+
+        glm::vec2 rotation = glm::radians(store.rotation(t, now));
+        glm::vec2 c(cosf(rotation.x), cosf(rotation.y));
+        glm::vec2 s(sinf(rotation.x), sinf(rotation.y));
+        glm::vec3 origin    = tile_unrotate(r.origin - centre, c, s);
+        glm::vec3 direction = tile_unrotate(r.direction, c, s);
+        glm::vec3 half(width / 2.0f, width / 2.0f, depth / 2.0f);
+        float t0 = 0.0f, t1 = std::numeric_limits<float>::max();
+        if (!slab(origin, direction, -half, half, t0, t1)) {
+            return false;
+        }
+        hit = t0;
+        return true;
+    }
+
+    // clip [t0, t1] to the part of the ray inside the box, false if it misses
+    static bool slab(const glm::vec3 &origin, const glm::vec3 &direction,
+                     const glm::vec3 &lo, const glm::vec3 &hi, float &t0, float &t1)
+    {
+        for (int a = 0; a < 3; a++) {
+            if (direction[a] == 0.0f) {
+                if (origin[a] < lo[a] || origin[a] > hi[a]) {
+                    return false;
+                }
+                continue;
+            }
+            float inv  = 1.0f / direction[a];
+            float near = (lo[a] - origin[a]) * inv;
+            float far  = (hi[a] - origin[a]) * inv;
+            if (near > far) {
+                std::swap(near, far);
+            }
+            t0 = std::max(t0, near);
+            t1 = std::min(t1, far);
+            if (t0 > t1) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif
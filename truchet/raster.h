@@ -0,0 +1,216 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <glm/glm.hpp>
+
+#include <tiles.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// CPU rasterizer for a TileStore seen from straight above, for images too big
+// for the GPU. It draws the same mesh as truchet.cpp (tiles.h): each tile's
+// corners go through the vertex shader's rotation and bump, faces turned
+// towards the viewer are kept and their triangles are filled in the tile's
+// on, off or edge colour.
+//
+// The image is produced one square block at a time so memory stays bounded:
+// a block only looks at the tiles of the regular board grid that can reach
+// it. render_block() touches nothing shared, so blocks can be rendered on as
+// many threads as there are. Edge functions are evaluated four pixels at a
+// time with SSE2 where available.
+class TileRasterizer
+{
+public:
+    // background where no tile covers a pixel, as the renderer's clear colour
+    glm::vec3 background;
+
+    // tiles: the board, laid out on a regular grid with tile (i, j) at
+    // origin + tile_space * (i, j); world_min/world_max: the area covered by
+    // the image, y up; now: time at which to evaluate the tile animation
+    TileRasterizer(const TileStore &tiles, float tile_width, float tile_depth, glm::vec2 origin, float tile_space,
+                   glm::vec2 world_min, glm::vec2 world_max, unsigned int image_width, unsigned int image_height,
+                   float now, int samples)
+        : background(0.0f, 0.0f, 0.2f),
+          store(tiles), width(tile_width), depth(tile_depth), grid_origin(origin), space(tile_space),
+          lo(world_min), hi(world_max), image_w(image_width), image_h(image_height), time(now),
+          samples_per_axis(std::max(1, samples))
+    {
+        pixels_per_unit = glm::vec2(image_w / (hi.x - lo.x), image_h / (hi.y - lo.y));
+        for (unsigned int v = 0; v < 8; v++) {
+            corners[v] = tile_corner(v, width, depth);
+        }
+    }
+
+    // render the block of size x size pixels with top left pixel (x0, y0)
+    // into rgb (size * size * 3 bytes, rows top to bottom); scratch is reused
+    // between calls on the same thread
+    void render_block(unsigned int x0, unsigned int y0, unsigned int size,
+                      unsigned char *rgb, std::vector<float> &scratch) const
+    {
+        size_t pixels = (size_t)size * size;
+        scratch.assign(pixels * 6, 0.0f);
+        float *accum  = &scratch[0];
+        float *sample = &scratch[pixels * 3];
+
+        // truchet tiles whose footprint can reach the block, one tile of margin for rotations
+        glm::vec2 block_lo = to_world((float)x0, (float)(y0 + size));
+        glm::vec2 block_hi = to_world((float)(x0 + size), (float)y0);
+        int i0 = std::max(0, (int)floor((block_lo.x - grid_origin.x) / space) - 1);
+        int i1 = std::min((int)store.nx - 1, (int)ceil((block_hi.x - grid_origin.x) / space) + 1);
+        int j0 = std::max(0, (int)floor((block_lo.y - grid_origin.y) / space) - 1);
+        int j1 = std::min((int)store.ny - 1, (int)ceil((block_hi.y - grid_origin.y) / space) + 1);
+
+        float weight = 1.0f / (samples_per_axis * samples_per_axis);
+        for (int sy = 0; sy < samples_per_axis; sy++) {
+            for (int sx = 0; sx < samples_per_axis; sx++) {
+                glm::vec2 offset((sx + 0.5f) / samples_per_axis, (sy + 0.5f) / samples_per_axis);
+                for (size_t p = 0; p < pixels; p++) {
+                    sample[3*p + 0] = background.r;
+                    sample[3*p + 1] = background.g;
+                    sample[3*p + 2] = background.b;
+                }
+                for (int i = i0; i <= i1; i++) {
+                    for (int j = j0; j <= j1; j++) {
+                        draw_tile(store.index(i, j), x0, y0, size, offset, sample);
+                    }
+                }
+                for (size_t p = 0; p < pixels * 3; p++) {
+                    accum[p] += weight * sample[p];
+                }
+            }
+        }
+        for (size_t p = 0; p < pixels * 3; p++) {
+            rgb[p] = (unsigned char)(255.0f * glm::clamp(accum[p], 0.0f, 1.0f) + 0.5f);
+        }
+    }
+
+private:
+    const TileStore &store;
+    float     width, depth;
+    glm::vec2 grid_origin;
+    float     space;
+    glm::vec2 lo, hi;
+    unsigned int image_w, image_h;
+    float     time;
+    int       samples_per_axis;
+    glm::vec2 pixels_per_unit;
+    glm::vec3 corners[8];
+
+    glm::vec2 to_world(float px, float py) const
+    {
+        return glm::vec2(lo.x + px / pixels_per_unit.x, hi.y - py / pixels_per_unit.y);
+    }
+
+    glm::vec2 to_pixel(const glm::vec3 &p) const
+    {
+        return glm::vec2((p.x - lo.x) * pixels_per_unit.x, (hi.y - p.y) * pixels_per_unit.y);
+    }
+
+    void draw_tile(unsigned int t, unsigned int x0, unsigned int y0, unsigned int size,
+                   glm::vec2 offset, float *sample) const
+    {
+        glm::vec2 rotation = glm::radians(store.rotation(t, time));
+        glm::vec3 lift(0.0f, 0.0f, store.bump(t, time));
+        glm::vec3 local[8];
+        glm::vec2 screen[8];
+        for (int v = 0; v < 8; v++) {
+            local[v]  = tile_rotate(corners[v], rotation);
+            screen[v] = to_pixel(local[v] + store.position[t] + lift) - glm::vec2((float)x0, (float)y0);
+        }
+
+        const unsigned int *faces[3]  = { tile_edge_indicies, tile_off_indicies, tile_on_indicies };
+        const unsigned int  counts[3] = { 24, 6, 6 };
+        const glm::vec3     colours[3] = { store.colour_edge[t], store.colour_off[t], store.colour_on[t] };
+        for (int face = 0; face < 3; face++) {
+            for (unsigned int k = 0; k < counts[face]; k += 3) {
+                const unsigned int *tri = &faces[face][k];
+                // the box is convex, so a face is visible when its outward normal points up
+                glm::vec3 normal = glm::cross(local[tri[1]] - local[tri[0]], local[tri[2]] - local[tri[0]]);
+                glm::vec3 centre = local[tri[0]] + local[tri[1]] + local[tri[2]];
+                if (glm::dot(normal, centre) < 0.0f) {
+                    normal = -normal;
+                }
+                if (normal.z <= 1.0e-6f * width * width) {
+                    continue;
+                }
+                fill_triangle(screen[tri[0]], screen[tri[1]], screen[tri[2]], colours[face], size, offset, sample);
+            }
+        }
+    }
+
+    // fill the samples at (x + offset) inside the triangle, pixel coordinates relative to the block
+    static void fill_triangle(glm::vec2 a, glm::vec2 b, glm::vec2 c, const glm::vec3 &colour,
+                              unsigned int size, glm::vec2 offset, float *sample)
+    {
+        float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (area == 0.0f) {
+            return;
+        }
+        if (area < 0.0f) {
+            std::swap(b, c);
+        }
+
+        int xmin = std::max(0, (int)floor(std::min(a.x, std::min(b.x, c.x)) - offset.x));
+        int xmax = std::min((int)size - 1, (int)ceil(std::max(a.x, std::max(b.x, c.x)) - offset.x));
+        int ymin = std::max(0, (int)floor(std::min(a.y, std::min(b.y, c.y)) - offset.y));
+        int ymax = std::min((int)size - 1, (int)ceil(std::max(a.y, std::max(b.y, c.y)) - offset.y));
+        if (xmin > xmax || ymin > ymax) {
+            return;
+        }
+
+        // edge k is E(x, y) = A[k] x + B[k] y + C[k], non-negative inside
+        const glm::vec2 v[3] = { a, b, c };
+        float A[3], B[3], C[3];
+        for (int k = 0; k < 3; k++) {
+            const glm::vec2 &p = v[k];
+            const glm::vec2 &q = v[(k + 1) % 3];
+            A[k] = p.y - q.y;
+            B[k] = q.x - p.x;
+            C[k] = -A[k] * p.x - B[k] * p.y;
+        }
+
+        for (int y = ymin; y <= ymax; y++) {
+            float sy = y + offset.y;
+            float *row = sample + (size_t)y * size * 3;
+#if defined(__SSE2__)
+            __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            __m128 row_e[3], step_a[3];
+            for (int k = 0; k < 3; k++) {
+                row_e[k]  = _mm_set1_ps(B[k] * sy + C[k]);
+                step_a[k] = _mm_set1_ps(A[k]);
+            }
+            for (int x = xmin; x <= xmax; x += 4) {
+                __m128 sx = _mm_add_ps(_mm_set1_ps(x + offset.x), lane);
+                __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(step_a[0], sx), row_e[0]), _mm_setzero_ps());
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(step_a[1], sx), row_e[1]), _mm_setzero_ps()));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(step_a[2], sx), row_e[2]), _mm_setzero_ps()));
+                int mask = _mm_movemask_ps(inside);
+                for (int l = 0; mask != 0; l++, mask >>= 1) {
+                    if ((mask & 1) && x + l <= xmax) {
+                        float *px = row + (size_t)(x + l) * 3;
+                        px[0] = colour.r; px[1] = colour.g; px[2] = colour.b;
+                    }
+                }
+            }
+#else
+            for (int x = xmin; x <= xmax; x++) {
+                float sx = x + offset.x;
+                if (A[0] * sx + B[0] * sy + C[0] >= 0.0f &&
+                    A[1] * sx + B[1] * sy + C[1] >= 0.0f &&
+                    A[2] * sx + B[2] * sy + C[2] >= 0.0f) {
+                    float *px = row + (size_t)x * 3;
+                    px[0] = colour.r; px[1] = colour.g; px[2] = colour.b;
+                }
+            }
+#endif
+        }
+    }
+};
+
+#endif
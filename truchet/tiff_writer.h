@@ -0,0 +1,167 @@
+#ifndef TIFF_WRITER_H
+#define TIFF_WRITER_H
+
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+// Streaming writer for uncompressed 8 bit RGB tiled TIFF files.
+//
+// Tiles all have the same size, so every tile offset is known up front: the
+// header and directory are written by open() and tiles are then appended in
+// row-major order with write_tile(), without the image ever being held in
+// memory. Files past 4 GiB are written as BigTIFF.
+class TiledTiffWriter
+{
+public:
+    unsigned int width, height, tile_size;
+    unsigned int tiles_across, tiles_down;
+
+    TiledTiffWriter() : width(0), height(0), tile_size(0), tiles_across(0), tiles_down(0), written(0) {}
+
+    // tile_size must be a multiple of 16
+    bool open(const std::string &path, unsigned int image_width, unsigned int image_height, unsigned int tile)
+    {
+        width        = image_width;
+        height       = image_height;
+        tile_size    = tile;
+        tiles_across = (width  + tile_size - 1) / tile_size;
+        tiles_down   = (height + tile_size - 1) / tile_size;
+        written      = 0;
+
+        file.open(path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cout << "ERROR::TIFF::CANNOT_OPEN " << path << std::endl;
+            return false;
+        }
+
+        uint64_t count      = tile_count();
+        uint64_t tile_bytes = (uint64_t)tile_size * tile_size * 3;
+        big = count * (tile_bytes + 8) + 1024 > 0xffffffffull;
+
+        // header, directory, then the offset and byte count arrays, then tiles
+        const int entries   = 11;
+        uint64_t ifd        = big ? 16 : 8;
+        uint64_t ifd_size   = big ? 8 + entries * 20 + 8 : 2 + entries * 12 + 4;
+        uint64_t bits       = ifd + ifd_size;                       // classic TIFF only, BigTIFF stores it inline
+        uint64_t word       = big ? 8 : 4;
+        uint64_t offsets    = bits + (big ? 0 : 8);
+        uint64_t counts     = offsets + (count > 1 ? count * word : 0);
+        uint64_t data       = counts + (count > 1 ? count * word : 0);
+
+        if (big) {
+            put16(0x4949); put16(43); put16(8); put16(0); put64(ifd);
+            put64(entries);
+        } else {
+            put16(0x4949); put16(42); put32((uint32_t)ifd);
+            put16(entries);
+        }
+        entry(256, TYPE_LONG,  1, width);                           // ImageWidth
+        entry(257, TYPE_LONG,  1, height);                          // ImageLength
+        if (big) {                                                  // BitsPerSample 8,8,8
+            put16(258); put16(TYPE_SHORT); put64(3);
+            put16(8); put16(8); put16(8); put16(0);
+        } else {
+            entry(258, TYPE_SHORT, 3, bits);
+        }
+        entry(259, TYPE_SHORT, 1, 1);                               // Compression: none
+        entry(262, TYPE_SHORT, 1, 2);                               // PhotometricInterpretation: RGB
+        entry(277, TYPE_SHORT, 1, 3);                               // SamplesPerPixel
+        entry(284, TYPE_SHORT, 1, 1);                               // PlanarConfiguration: chunky
+        entry(322, TYPE_LONG,  1, tile_size);                       // TileWidth
+        entry(323, TYPE_LONG,  1, tile_size);                       // TileLength
+        entry(324, big ? TYPE_LONG8 : TYPE_LONG, count, count > 1 ? offsets : data);   // TileOffsets
+        entry(325, big ? TYPE_LONG8 : TYPE_LONG, count, count > 1 ? counts : tile_bytes); // TileByteCounts
+        if (big) {
+            put64(0);
+        } else {
+            put32(0);
+            put16(8); put16(8); put16(8); put16(0);
+        }
+        if (count > 1) {
+            for (uint64_t t = 0; t < count; t++) {
+                putword(data + t * tile_bytes);
+            }
+            for (uint64_t t = 0; t < count; t++) {
+                putword(tile_bytes);
+            }
+        }
+        return file.good();
+    }
+
+    uint64_t tile_count() const { return (uint64_t)tiles_across * tiles_down; }
+
+    // append the next tile, tile_size * tile_size RGB pixels, rows top to bottom
+    bool write_tile(const unsigned char *rgb)
+    {
+        file.write((const char *)rgb, (std::streamsize)tile_size * tile_size * 3);
+        written++;
+        return file.good();
+    }
+
+    bool close()
+    {
+        if (written != tile_count()) {
+            std::cout << "ERROR::TIFF::INCOMPLETE " << written << " of " << tile_count() << " tiles" << std::endl;
+        }
+        file.close();
+        return !file.fail() && written == tile_count();
+    }
+
+private:
+    enum { TYPE_SHORT = 3, TYPE_LONG = 4, TYPE_LONG8 = 16 };
+
+    std::ofstream file;
+    bool          big;
+    uint64_t      written;
+
+    void put16(uint16_t v)
+    {
+        unsigned char b[2] = { (unsigned char)v, (unsigned char)(v >> 8) };
+        file.write((const char *)b, 2);
+    }
+    void put32(uint32_t v)
+    {
+        put16((uint16_t)v);
+        put16((uint16_t)(v >> 16));
+    }
+    void put64(uint64_t v)
+    {
+        put32((uint32_t)v);
+        put32((uint32_t)(v >> 32));
+    }
+    void putword(uint64_t v)
+    {
+        if (big) {
+            put64(v);
+        } else {
+            put32((uint32_t)v);
+        }
+    }
+
+    // one directory entry; single SHORT/LONG values are stored inline
+    void entry(uint16_t tag, uint16_t type, uint64_t count, uint64_t value)
+    {
+        put16(tag);
+        put16(type);
+        if (big) {
+            put64(count);
+            if (type == TYPE_SHORT && count == 1) {
+                put16((uint16_t)value); put16(0); put32(0);
+            } else {
+                put64(value);
+            }
+        } else {
+            put32((uint32_t)count);
+            if (type == TYPE_SHORT && count == 1) {
+                put16((uint16_t)value); put16(0);
+            } else {
+                put32((uint32_t)value);
+            }
+        }
+    }
+};
+
+#endif
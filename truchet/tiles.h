@@ -0,0 +1,268 @@
+#ifndef TILES_H
+#define TILES_H
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/*
+ * Tile mesh shared by the renderer and the offline rasterizer
+ *
+ *              4-------5
+ *             /|      /|
+ *            0-------1 |
+ *            | |     | |
+ *            | 6-----|-7
+ *            |/      |/
+ *            2-------3
+ *
+ * Corners 0-3 are the front (z+) face, 4-7 the rear. Each face is split along
+ * the 1-2 diagonal into an on triangle (upper left) and an off triangle.
+ */
+const unsigned int tile_on_indicies[6] = {
+    0, 1, 2, // Front triangle
+    4, 5, 6  // Rear triangle
+};
+const unsigned int tile_off_indicies[6] = {
+    1, 3, 2,
+    5, 7, 6
+};
+const unsigned int tile_edge_indicies[24] = {
+    0, 1, 4,
+    1, 3, 5,
+    3, 2, 7,
+    2, 0, 6,
+    4, 5, 1,
+    5, 7, 3,
+    7, 6, 2,
+    6, 4, 0
+};
+
+// corner v of a tile width wide and depth thick, centred on the origin
+GLM_CONSTEXPR glm::vec3 tile_corner(unsigned int v, float width, float depth)
+{
+    return glm::vec3((v & 1) ? width / 2.0f : -width / 2.0f,
+                     (v & 2) ? -width / 2.0f : width / 2.0f,
+                     (v & 4) ? -depth / 2.0f : depth / 2.0f);
+}
+
+// The three face classes merged into one mesh, each vertex tagged with its
+// class (0 edge, 1 off, 2 on) so every tile draws in one call. Faces don't
+// share vertices: edges use all 8 corners, the off and on faces 6 each.
+const unsigned int tile_mesh_vertex_count = 20;
+const unsigned int tile_mesh_index_count  = 36;
+
+struct tile_mesh {
+    float        vertices[tile_mesh_vertex_count * 4];
+    unsigned int indicies[tile_mesh_index_count];
+};
+
+// Built at compile time for a fixed tile size, wherever glm is constexpr
+GLM_CONSTEXPR struct tile_mesh make_tile_mesh(float width, float depth)
+{
+    const unsigned int *face_indicies[3] = { tile_edge_indicies, tile_off_indicies, tile_on_indicies };
+    const unsigned int face_index_count[3] = { 24, 6, 6 };
+    struct tile_mesh mesh = {};
+    unsigned int vertex = 0, index = 0;
+    for (unsigned int face = 0; face < 3; face++) {
+        int remap[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+        for (unsigned int k = 0; k < face_index_count[face]; k++) {
+            unsigned int v = face_indicies[face][k];
+            if (remap[v] < 0) {
+                glm::vec3 corner = tile_corner(v, width, depth);
+                mesh.vertices[vertex * 4 + 0] = corner.x;
+                mesh.vertices[vertex * 4 + 1] = corner.y;
+                mesh.vertices[vertex * 4 + 2] = corner.z;
+                mesh.vertices[vertex * 4 + 3] = (float)face;
+                remap[v] = vertex++;
+            }
+            mesh.indicies[index++] = remap[v];
+        }
+    }
+    return mesh;
+}
+
+// Tile orientation as the vertex shader applies it: rotate about x by
+// rotation.y, then about y by rotation.x (radians)
+inline glm::vec3 tile_rotate(glm::vec3 p, glm::vec2 rotation)
+{
+    float cx = cosf(rotation.x), sx = sinf(rotation.x);
+    float cy = cosf(rotation.y), sy = sinf(rotation.y);
+    p = glm::vec3(p.x, cy * p.y - sy * p.z, sy * p.y + cy * p.z);
+    return glm::vec3(cx * p.x + sx * p.z, p.y, -sx * p.x + cx * p.z);
+}
+
+// inverse of tile_rotate, given the cosines and sines of the rotation
+inline glm::vec3 tile_unrotate(glm::vec3 p, glm::vec2 c, glm::vec2 s)
+{
+    p = glm::vec3(c.x * p.x - s.x * p.z, p.y, s.x * p.x + c.x * p.z);
+    return glm::vec3(p.x, c.y * p.y + s.y * p.z, -s.y * p.y + c.y * p.z);
+}
+
+// PCG hash (Jarzynski & Olano, "Hash Functions for GPU Rendering")
+inline uint32_t pcg_hash(uint32_t v)
+{
+    uint32_t state = v * 747796405u + 2891336453u;
+    uint32_t word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// Orientation and colour of a procedural tile, the same distribution the
+// fixed board draws from: on colour red with random green and blue, flips of
+// 0 or 180 degrees about each axis
+struct tile_pattern {
+    bool      flip_x;
+    bool      flip_y;
+    glm::vec3 colour_on;
+};
+
+inline struct tile_pattern tile_pattern_at(int i, int j, uint32_t seed)
+{
+    uint32_t h = pcg_hash(pcg_hash((uint32_t)i + seed) + (uint32_t)j);
+    struct tile_pattern p;
+    p.flip_x    = (h >> 30) & 1u;
+    p.flip_y    = (h >> 31) & 1u;
+    p.colour_on = glm::vec3(1.0f, 0.005f * (h % 101u), 0.005f * ((h >> 8) % 101u));
+    return p;
+}
+
+const glm::vec3 tile_colour_off  = glm::vec3(1.0f, 1.0f, 1.0f);
+const glm::vec3 tile_colour_edge = glm::vec3(0.8f, 0.8f, 0.8f);
+
+// Animation state of one tile as stored in the GPU state buffer. Rotations
+// move from rotation_from toward target_rotation at a fixed rate starting at
+// rotation_start, and the z bump decays from bump_start, so the vertex shader
+// can evaluate any tile at any time without the CPU stepping it.
+struct tile_state {
+    glm::vec2 rotation_from;
+    glm::vec2 target_rotation;
+    float     rotation_start;
+    float     bump_start;
+};
+
+// Tile grid for an nx by ny board, tile (i, j) lives at index i*ny + j.
+// Fixed per-tile data is kept as separate arrays; the animation state only
+// changes on events (flips, bumps), which mark the tile dirty for upload.
+class TileStore
+{
+public:
+    unsigned int nx, ny;
+
+    std::vector<glm::vec3> position;
+    std::vector<glm::vec3> colour_on;
+    std::vector<glm::vec3> colour_off;
+    std::vector<glm::vec3> colour_edge;
+    std::vector<struct tile_state> state;
+
+    // tiles whose state changed since the last upload
+    std::vector<unsigned int> dirty;
+
+    // tiles whose bump may still be above the board, pruned on each release
+    std::vector<unsigned int> raised;
+
+    // degrees per second, bump height and its decay per second
+    float angle_step;
+    float bump_height;
+    float z_step;
+
+    TileStore(unsigned int num_x, unsigned int num_y, float angle_rate, float bump, float bump_rate)
+        : nx(num_x), ny(num_y),
+          position(nx * ny), colour_on(nx * ny), colour_off(nx * ny), colour_edge(nx * ny),
+          state(nx * ny),
+          angle_step(angle_rate), bump_height(bump), z_step(bump_rate),
+          is_dirty(nx * ny, 0)
+    {
+        for (unsigned int t = 0; t < nx * ny; t++) {
+            state[t].rotation_from   = glm::vec2(0.0f);
+            state[t].target_rotation = glm::vec2(0.0f);
+            state[t].rotation_start  = 0.0f;
+            state[t].bump_start      = -bump_height / z_step;
+        }
+    }
+
+    unsigned int size() const { return nx * ny; }
+    unsigned int index(unsigned int i, unsigned int j) const { return i * ny + j; }
+
+    // rotation of a tile at time now, same formula as the vertex shader
+    glm::vec2 rotation(unsigned int t, float now) const
+    {
+        const struct tile_state &s = state[t];
+        float travel = angle_step * std::max(0.0f, now - s.rotation_start);
+        return glm::vec2(approach(s.rotation_from.x, s.target_rotation.x, travel),
+                         approach(s.rotation_from.y, s.target_rotation.y, travel));
+    }
+
+    // z bump of a tile at time now, ignoring the highlighted tile held at full height
+    float bump(unsigned int t, float now) const
+    {
+        return std::max(0.0f, bump_height - z_step * (now - state[t].bump_start));
+    }
+
+    glm::vec2 target(unsigned int t) const { return state[t].target_rotation; }
+
+    // start rotating toward a new target from wherever the tile is now
+    void set_target(unsigned int t, glm::vec2 target, float now)
+    {
+        state[t].rotation_from   = rotation(t, now);
+        state[t].target_rotation = target;
+        state[t].rotation_start  = now;
+        mark(t);
+    }
+
+    // start the z bump decaying from full height
+    void release_bump(unsigned int t, float now)
+    {
+        state[t].bump_start = now;
+        mark(t);
+        size_t kept = 0;
+        for (size_t n = 0; n < raised.size(); n++) {
+            if (raised[n] != t && bump(raised[n], now) > 0.0f) {
+                raised[kept++] = raised[n];
+            }
+        }
+        raised.resize(kept);
+        raised.push_back(t);
+    }
+
+    // contiguous runs [first, first + count) of dirty tiles in index order, so
+    // the state buffer can be updated with one sub-range upload per run;
+    // clears the dirty list
+    void dirty_runs(std::vector<std::pair<unsigned int, unsigned int> > &runs)
+    {
+        runs.clear();
+        std::sort(dirty.begin(), dirty.end());
+        for (size_t n = 0; n < dirty.size(); n++) {
+            is_dirty[dirty[n]] = 0;
+            if (!runs.empty() && runs.back().first + runs.back().second == dirty[n]) {
+                runs.back().second++;
+            } else {
+                runs.push_back(std::make_pair(dirty[n], 1u));
+            }
+        }
+        dirty.clear();
+    }
+
+private:
+    std::vector<unsigned char> is_dirty;
+
+    void mark(unsigned int t)
+    {
+        if (!is_dirty[t]) {
+            is_dirty[t] = 1;
+            dirty.push_back(t);
+        }
+    }
+
+    static float approach(float from, float target, float travel)
+    {
+        if (fabs(target - from) <= travel) {
+            return target;
+        }
+        return (target > from) ? from + travel : from - travel;
+    }
+};
+
+#endif
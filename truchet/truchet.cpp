@@ -5,22 +5,26 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <uniform_buffer.h>
+#include <program_cache.h>
+#include <frame_clock.h>
+#include <tiles.h>
+#include <chunks.h>
+#include <picking.h>
+
 #include <iostream>
 #include <random>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdlib>
 #include <cmath>
-#include <ctime>
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow *window);
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
+void stream_camera(GLFWwindow *window, TileStreamer *streamer, double seconds);
 
-struct tile {
-    glm::vec3 position;
-    glm::vec2 rotation;
-    glm::vec2 target_rotation;
-    glm::vec3 colour_on;
-    glm::vec3 colour_off;
-    glm::vec3 colour_edge;
-};
 
 // settings
 const unsigned int SCR_WIDTH  = 1000;
@@ -29,33 +33,110 @@ const unsigned int SCR_HEIGHT = 1000;
 // Paramaters for number and size of tiles
 const unsigned int num_tiles_x     = 12;
 const unsigned int num_tiles_y     = 12;
-const float tile_gap_width_ratio   = 0.0f;
-const float tile_depth_width_ratio = 0.1f;
+constexpr float tile_gap_width_ratio   = 0.0f;
+constexpr float tile_depth_width_ratio = 0.1f;
 
 // global state
 bool zero_pressed     = 0;
 bool zero_was_pressed = 0;
 bool colour_full      = 1;
 
+// Streaming mode (./truchet --stream [--seed=N]): an unbounded procedural plane
+// instead of the fixed board, see chunks.h. WASD/arrows pan, Q/E or the scroll
+// wheel zoom, 0 switches to a new plane.
+bool     stream_mode   = 0;
+uint32_t stream_seed   = 1;
+double   scroll_offset = 0.0;
+
+// Face classes of a tile, stored per vertex so every tile draws in one call
+#define FACE_EDGE 0
+#define FACE_OFF  1
+#define FACE_ON   2
+
+// Per frame constants, std140 layout of the Frame block in the vertex shader
+struct frame_block {
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 highlight_colour;
+    int       highlight_tile;
+    int       colour_full;
+    float     time;
+    float     angle_step;
+    float     z_step;
+    float     bump_height;
+    float     pad[2];
+};
+
+
+// The vertex shader animates each tile from its event state (see tiles.h):
+// rotation about x by rotation.y, then about y by rotation.x, then translation
+// to the tile position plus its z bump, matching the old CPU glm::rotate calls.
 const char *vertexShaderSource = "#version 330 core\n"
     "layout (location = 0) in vec3 aPos;\n"
-    "uniform mat4 model;\n"
-    "uniform mat4 view;\n"
-    "uniform mat4 projection;\n"
+    "layout (location = 1) in float aFace;\n"
+    "layout (location = 2) in vec3 aPosition;\n"
+    "layout (location = 3) in vec4 aRotation;\n"
+    "layout (location = 4) in vec2 aStart;\n"
+    "layout (location = 5) in vec3 aColourOn;\n"
+    "layout (location = 6) in vec3 aColourOff;\n"
+    "layout (location = 7) in vec3 aColourEdge;\n"
+    "uniform vec3 chunkOffset;\n"
+    "layout (std140) uniform Frame {\n"
+    "   mat4  view;\n"
+    "   mat4  projection;\n"
+    "   vec4  highlightColour;\n"
+    "   int   highlightTile;\n"
+    "   bool  colourFull;\n"
+    "   float time;\n"
+    "   float angleStep;\n"
+    "   float zStep;\n"
+    "   float bumpHeight;\n"
+    "};\n"
+    "flat out vec3 colour;\n"
     "void main()\n"
     "{\n"
-    "   gl_Position = projection * view * model * vec4(aPos, 1.0);\n"
+    "   float travel = angleStep * max(0.0, time - aStart.x);\n"
+    "   vec2 delta = aRotation.zw - aRotation.xy;\n"
+    "   vec2 rotation = radians(aRotation.xy + sign(delta) * min(abs(delta), vec2(travel)));\n"
+    "   vec2 c = cos(rotation);\n"
+    "   vec2 s = sin(rotation);\n"
+    "   vec3 p = vec3(aPos.x, c.y * aPos.y - s.y * aPos.z, s.y * aPos.y + c.y * aPos.z);\n"
+    "   p = vec3(c.x * p.x + s.x * p.z, p.y, -s.x * p.x + c.x * p.z);\n"
+    "   float z = (gl_InstanceID == highlightTile) ? bumpHeight : max(0.0, bumpHeight - zStep * (time - aStart.y));\n"
+    "   gl_Position = projection * view * vec4(p + aPosition + chunkOffset + vec3(0.0, 0.0, z), 1.0);\n"
+    "   if (aFace < 0.5) {\n"
+    "       colour = aColourEdge;\n"
+    "   } else if (aFace < 1.5) {\n"
+    "       colour = aColourOff;\n"
+    "   } else if (gl_InstanceID == highlightTile) {\n"
+    "       colour = highlightColour.rgb;\n"
+    "   } else {\n"
+    "       colour = colourFull ? aColourOn : vec3(0.0);\n"
+    "   }\n"
     "}\0";
 const char *fragmentShaderSource = "#version 330 core\n"
-    "uniform vec3 uColour;\n"
+    "flat in vec3 colour;\n"
     "out vec4 FragColor;\n"
     "void main()\n"
     "{\n"
-    "   FragColor = vec4(uColour, 1.0f);\n"
+    "   FragColor = vec4(colour, 1.0f);\n"
     "}\n\0";
 
-int main()
+int main(int argc, char *argv[])
 {
+    const std::string seedOption = "--seed=";
+    for (int a = 1; a < argc; a++) {
+        std::string arg = argv[a];
+        if (arg == "--stream") {
+            stream_mode = 1;
+        } else if (arg.compare(0, seedOption.size(), seedOption) == 0) {
+            stream_seed = std::strtoul(arg.substr(seedOption.size()).c_str(), NULL, 10);
+        } else {
+            std::cout << "Usage: " << argv[0] << " [--stream] [--seed=N]" << std::endl;
+            return -1;
+        }
+    }
+
     // glfw: initialize and configure
     // ------------------------------
     glfwInit();
@@ -78,6 +159,7 @@ int main()
     }
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetScrollCallback(window, scroll_callback);
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
 
     // glad: load all OpenGL function pointers
@@ -88,147 +170,89 @@ int main()
         return -1;
     }
 
-    // build and compile our shader program
+    // build and compile our shader program, or load it from the binary cache
     // ------------------------------------
-    // vertex shader
-    int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    // check for shader compile errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // fragment shader
-    int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    // check for shader compile errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    // link shaders
-    int shaderProgram  = glCreateProgram();
+    std::vector<ProgramStage> stages;
+    stages.push_back(ProgramStage(GL_VERTEX_SHADER, vertexShaderSource));
+    stages.push_back(ProgramStage(GL_FRAGMENT_SHADER, fragmentShaderSource));
+    int shaderProgram  = ProgramCache::shared().build(stages, "TILE");
     int shaderTriangle = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    // check for linking errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
 
     glEnable(GL_DEPTH_TEST);
 
-    /* 
-     * Set up vertex data for truchet tile
-     *
-     *              4-------5
-     *             /|      /|
-     *            0-------1 |
-     *            | |     | |
-     *            | 6-----|-7
-     *            |/      |/
-     *            2-------3
-     */
-
-    float tile_width = 2.0f / (std::max(num_tiles_x, num_tiles_y) * (1.0f + tile_gap_width_ratio));
-    float tile_depth = tile_width * tile_depth_width_ratio;
-    float tile_vertices[] = {
-        -tile_width / 2.0f, +tile_width / 2.0f, +tile_depth / 2.0f,
-        +tile_width / 2.0f, +tile_width / 2.0f, +tile_depth / 2.0f,
-        -tile_width / 2.0f, -tile_width / 2.0f, +tile_depth / 2.0f,
-        +tile_width / 2.0f, -tile_width / 2.0f, +tile_depth / 2.0f,
-        -tile_width / 2.0f, +tile_width / 2.0f, -tile_depth / 2.0f,
-        +tile_width / 2.0f, +tile_width / 2.0f, -tile_depth / 2.0f,
-        -tile_width / 2.0f, -tile_width / 2.0f, -tile_depth / 2.0f,
-        +tile_width / 2.0f, -tile_width / 2.0f, -tile_depth / 2.0f,
-    };
-    unsigned int tile_on_indicies[] = {
-        0, 1, 2, // Front triangle
-        4, 5, 6  // Rear triangle
-    };
-    unsigned int tile_off_indicies[] = {
-        1, 3, 2,
-        5, 7, 6 
-    };
-    unsigned int tile_edge_indicies[] = {
-        0, 1, 4,
-        1, 3, 5,
-        3, 2, 7,
-        2, 0, 6,
-        4, 5, 1,
-        5, 7, 3,
-        7, 6, 2,
-        6, 4, 0 
-    };
-    
-    unsigned int VAO_tile_on, VAO_tile_off, VAO_tile_edge;
-    unsigned int EBO_tile_on, EBO_tile_off, EBO_tile_edge;
-    unsigned int VBO_tile;
-    glGenVertexArrays(1, &VAO_tile_on);
-    glGenVertexArrays(1, &VAO_tile_off);
-    glGenVertexArrays(1, &VAO_tile_edge);
-    glGenBuffers(1, &EBO_tile_on);
-    glGenBuffers(1, &EBO_tile_off);
-    glGenBuffers(1, &EBO_tile_edge);
+    // Set up vertex data for truchet tile, the corners and face split are in tiles.h
+    constexpr float tile_width = 2.0f / (std::max(num_tiles_x, num_tiles_y) * (1.0f + tile_gap_width_ratio));
+    constexpr float tile_depth = tile_width * tile_depth_width_ratio;
+    static GLM_CONSTEXPR const struct tile_mesh mesh = make_tile_mesh(tile_width, tile_depth);
+
+    // animation rates are per second: angle_step degrees, z_step down from bump_height
+    float angle_step  = 240.f;
+    float z_step      = 0.3f;
+    float bump_height = 0.2f;
+    TileStore tiles(num_tiles_x, num_tiles_y, angle_step, bump_height, z_step);
+    unsigned int num_tiles = tiles.size();
+
+    // Per tile instance data: positions and colours are uploaded once, the
+    // animation state only when an event changes it
+    unsigned int VAO_tile, VBO_tile, EBO_tile, VBO_position, VBO_state;
+    unsigned int VBO_colour[3];
+    glGenVertexArrays(1, &VAO_tile);
     glGenBuffers(1, &VBO_tile);
+    glGenBuffers(1, &EBO_tile);
+    glGenBuffers(1, &VBO_position);
+    glGenBuffers(1, &VBO_state);
+    glGenBuffers(3, VBO_colour);
 
-    glBindVertexArray(VAO_tile_on);
+    glBindVertexArray(VAO_tile);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO_tile);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(tile_vertices), tile_vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(mesh.vertices), mesh.vertices, GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_tile_on);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(tile_on_indicies), tile_on_indicies, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_tile);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(mesh.indicies), mesh.indicies, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    // position and face class
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
-
-
-    glBindVertexArray(VAO_tile_off);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_tile);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(tile_vertices), tile_vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_tile_off);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(tile_off_indicies), tile_off_indicies, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindVertexArray(VAO_tile_edge);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_tile);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(tile_vertices), tile_vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_tile_edge);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(tile_edge_indicies), tile_edge_indicies, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    // per tile position
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_position);
+    glBufferData(GL_ARRAY_BUFFER, num_tiles * sizeof(glm::vec3), NULL, GL_STATIC_DRAW);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+    // per tile animation state: rotation from/target and start times
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_state);
+    glBufferData(GL_ARRAY_BUFFER, num_tiles * sizeof(struct tile_state), NULL, GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(struct tile_state), (void*)offsetof(struct tile_state, rotation_from));
+    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(struct tile_state), (void*)offsetof(struct tile_state, rotation_start));
+    for (int attrib = 3; attrib <= 4; attrib++) {
+        glEnableVertexAttribArray(attrib);
+        glVertexAttribDivisor(attrib, 1);
+    }
+    // per tile on, off and edge colours
+    for (int k = 0; k < 3; k++) {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO_colour[k]);
+        glBufferData(GL_ARRAY_BUFFER, num_tiles * sizeof(glm::vec3), NULL, GL_STATIC_DRAW);
+        glVertexAttribPointer(5 + k, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+        glEnableVertexAttribArray(5 + k);
+        glVertexAttribDivisor(5 + k, 1);
+    }
 
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    glm::mat4 trans      = glm::mat4(1.0f);
-    glm::mat4 projection = glm::mat4(1.0f);
-    glm::mat4 view       = glm::mat4(1.0f);
-
-    projection = glm::perspective(glm::radians(40.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-    view       = glm::translate(view, glm::vec3(0.0f, 0.0f, -3.0f));
+    // the board camera never moves, so its matrices are built at compile time;
+    // glm::perspective is only constant evaluated with __builtin_is_constant_evaluated
+    // (GCC 9, Clang 9, Visual C++ 2019 16.5), older compilers build it at startup
+#if GLM_HAS_IS_CONSTANT_EVALUATED
+    constexpr glm::mat4 projection = glm::perspective(glm::radians(40.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+#else
+    const glm::mat4 projection     = glm::perspective(glm::radians(40.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+#endif
+    GLM_CONSTEXPR const glm::mat4 view = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -3.0f));
 
     std::random_device dev;
     std::mt19937 rng(dev());
@@ -240,41 +264,60 @@ int main()
     int i, j;
     float x, y;
     float tile_space = tile_width * (1.0f + tile_gap_width_ratio);
-    struct tile **tiles = (struct tile **)malloc(num_tiles_x * sizeof(struct tile*));
+    TileStreamer *streamer = NULL;
+    if (stream_mode) {
+        streamer = new TileStreamer(VBO_tile, EBO_tile, tile_mesh_index_count, shaderProgram,
+                                    tile_space, tile_depth, stream_seed);
+    }
     for (i=0; i<num_tiles_x; i++) {
-        tiles[i] = (struct tile *)malloc(num_tiles_y * sizeof(struct tile));
         for (j=0; j<num_tiles_y;j++) {
-            tiles[i][j].position.x = tile_space * (i - (num_tiles_x-1)/2.0f);
-            tiles[i][j].position.y = tile_space * (j - (num_tiles_y-1)/2.0f);
-            tiles[i][j].position.z = 0.0f;
-
-            tiles[i][j].rotation.x = 0.0f;
-            tiles[i][j].rotation.y = 0.0f;
+            unsigned int t = tiles.index(i, j);
+            tiles.position[t].x = tile_space * (i - (num_tiles_x-1)/2.0f);
+            tiles.position[t].y = tile_space * (j - (num_tiles_y-1)/2.0f);
+            tiles.position[t].z = 0.0f;
 
 #ifdef RANDOMISE_TILES
-            tiles[i][j].target_rotation.x = 180.0f * dist2(rng);
-            tiles[i][j].target_rotation.y = 180.0f * dist2(rng);
-#else
-            tiles[i][j].target_rotation.x = 0.0f;
-            tiles[i][j].target_rotation.y = 0.0f;
+            tiles.set_target(t, glm::vec2(180.0f * dist2(rng), 180.0f * dist2(rng)), 0.0f);
 #endif
 
-            tiles[i][j].colour_on = glm::vec3(1.0f, 0.005f*dist100(rng), 0.005f*dist100(rng));
-            tiles[i][j].colour_off = glm::vec3(1.0f, 1.0f, 1.0f);
-            tiles[i][j].colour_edge = glm::vec3(0.8f, 0.8f, 0.8f);
+            tiles.colour_on[t] = glm::vec3(1.0f, 0.005f*dist100(rng), 0.005f*dist100(rng));
+            tiles.colour_off[t] = tile_colour_off;
+            tiles.colour_edge[t] = tile_colour_edge;
         }
     }
 
+    // initial upload of every tile, after this only tiles hit by events are sent
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_position);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, num_tiles * sizeof(glm::vec3), tiles.position.data());
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_state);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, num_tiles * sizeof(struct tile_state), tiles.state.data());
+    tiles.dirty.clear();
+    const std::vector<glm::vec3> *colours[3] = { &tiles.colour_on, &tiles.colour_off, &tiles.colour_edge };
+    for (int k = 0; k < 3; k++) {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO_colour[k]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, num_tiles * sizeof(glm::vec3), colours[k]->data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    std::vector<std::pair<unsigned int, unsigned int> > dirty_runs;
+
+    // cursor picking against the tiles as drawn, positions are fixed from here on
+    TilePicker picker(tiles, tile_width, tile_depth);
+
+    // per frame constants are uploaded once per frame into a uniform buffer
+    UniformBuffer<struct frame_block> *frame_ubo = new UniformBuffer<struct frame_block>(0);
+    frame_ubo->attach(shaderProgram, "Frame");
+    struct frame_block frame = {};
+
     double mouse_x, mouse_y;
 
     // render loop
     // -----------
     float blue = 0.f;
-    clock_t begin = clock();
-    clock_t accumilator = clock();
-    int time_step = 3000;
-    float angle_step = 4.f;
-    float z_step = 0.005f;
+    float anim_time = 0.0f;
+    // the player's tile is sampled at a fixed rate, the tiles themselves
+    // animate in continuous time on the GPU
+    FrameClock frame_clock(1.0 / 240.0);
+    frame_clock.setSwapMode(SWAP_VSYNC);
     int player_x = -1;
     int player_y = -1;
 
@@ -285,17 +328,20 @@ int main()
 
     while (!glfwWindowShouldClose(window))
     {  
-        blue = 0.5f +  (1.0f + sin( 0.000003f * double(clock()-begin) ))/4.0f;
+        int steps = frame_clock.tick();
+        anim_time = (float)frame_clock.time();
+        blue = 0.5f +  (1.0f + sin( 3.0f * anim_time ))/4.0f;
         // input
         // -----
         processInput(window);
 
+        if (zero_pressed && !zero_was_pressed && stream_mode) {
+            streamer->reseed(stream_seed = rng());
+            zero_was_pressed = 1;
+        }
         if (zero_pressed && !zero_was_pressed) {
-            for (i=0; i<num_tiles_x; i++) {
-                for (j=0; j<num_tiles_y; j++) {
-                        tiles[i][j].target_rotation.x += 180.0f * dist2(rng);
-                        tiles[i][j].target_rotation.y += 180.0f * dist2(rng);
-                }
+            for (unsigned int t = 0; t < num_tiles; t++) {
+                tiles.set_target(t, tiles.target(t) + glm::vec2(180.0f * dist2(rng), 180.0f * dist2(rng)), anim_time);
             }
             zero_was_pressed = 1;
         }
@@ -307,103 +353,102 @@ int main()
         glClearColor(0.0f, 0.0f, 0.2f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        int i, j;
-        float dx, dy;
-        float angle;
-        for (i=0; i<num_tiles_x; i++) {
-            for (j=0; j<num_tiles_y; j++) {
-                
-                if (fabs(tiles[i][j].target_rotation.x - tiles[i][j].rotation.x) < angle_step) {
-                    tiles[i][j].rotation.x = tiles[i][j].target_rotation.x;
-                } else {
-                    if (tiles[i][j].target_rotation.x > tiles[i][j].rotation.x) {
-                        tiles[i][j].rotation.x += angle_step;
-                    } else {
-                        tiles[i][j].rotation.x -= angle_step;
-                    }
-                }
-                if (fabs(tiles[i][j].target_rotation.y - tiles[i][j].rotation.y) < angle_step) {
-                    tiles[i][j].rotation.y = tiles[i][j].target_rotation.y;
-                } else {
-                    if (tiles[i][j].target_rotation.y > tiles[i][j].rotation.y) {
-                        tiles[i][j].rotation.y += angle_step;
-                    } else {
-                        tiles[i][j].rotation.y -= angle_step;
-                    }
-                }
-
-                if (i == player_x && j == player_y) {
-                    tiles[i][j].position.z = 0.2f;
-                }
-                if (tiles[i][j].position.z > 0) {
-                    tiles[i][j].position.z -= z_step;
-                }
-
-                angle = 0.000001f * double(clock()-begin);
-
-                trans = glm::mat4(1.0f);
-                trans = glm::translate(trans, tiles[i][j].position);
-
-                trans = glm::rotate(trans, glm::radians(tiles[i][j].rotation.x), glm::vec3(0.0, 1.0, 0.0));
-                trans = glm::rotate(trans, glm::radians(tiles[i][j].rotation.y), glm::vec3(1.0, 0.0, 0.0));
-
-                glUseProgram(shaderProgram);
-
-                glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(trans));
-                glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-                glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
-
-                glUniform3f(glGetUniformLocation(shaderProgram, "uColour"), tiles[i][j].colour_edge.x, tiles[i][j].colour_edge.y, tiles[i][j].colour_edge.z);
-                glBindVertexArray(VAO_tile_edge);
-                glDrawElements(GL_TRIANGLES, 24, GL_UNSIGNED_INT, 0);
+        if (stream_mode) {
+            int fb_width, fb_height;
+            glfwGetFramebufferSize(window, &fb_width, &fb_height);
+            stream_camera(window, streamer, frame_clock.frameTime());
+
+            frame.view             = streamer->view();
+            frame.projection       = streamer->projection((float)fb_width / std::max(fb_height, 1));
+            frame.highlight_tile   = -1;
+            frame.colour_full      = colour_full;
+            frame.time             = anim_time;
+            frame_ubo->update(frame);
+            streamer->draw(frame.view, frame.projection, fb_height);
+
+            if (frame_clock.pacingReady()) {
+                std::string title = std::to_string(streamer->chunks_drawn) + " chunks, " +
+                                    std::to_string(streamer->nodes_drawn) + " LOD nodes | " + frame_clock.pacingText();
+                glfwSetWindowTitle(window, title.c_str());
+            }
 
-                glUniform3f(glGetUniformLocation(shaderProgram, "uColour"), tiles[i][j].colour_off.x, tiles[i][j].colour_off.y, tiles[i][j].colour_off.z);
-                glBindVertexArray(VAO_tile_off);
-                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+            frame_clock.limit();
+            continue;
+        }
 
-                if (i == player_x && j == player_y) {
-                    glUniform3f(glGetUniformLocation(shaderProgram, "uColour"), 0.0f, blue, 0.0f);
-                } else {
-                    if (colour_full) {
-                        glUniform3f(glGetUniformLocation(shaderProgram, "uColour"), tiles[i][j].colour_on.x, tiles[i][j].colour_on.y, tiles[i][j].colour_on.z);
-                    } else {
-                        glUniform3f(glGetUniformLocation(shaderProgram, "uColour"), 0.0f, 0.0f, 0.0f);
-                    }
-                }
-                glBindVertexArray(VAO_tile_on);
-                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
- 
-                glBindVertexArray(0);
+        // upload the state of tiles hit by events, falling back to one full
+        // upload when most of the grid changed
+        bool full_upload = tiles.dirty.size() > num_tiles / 2;
+        tiles.dirty_runs(dirty_runs);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO_state);
+        if (full_upload) {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, num_tiles * sizeof(struct tile_state), tiles.state.data());
+        } else {
+            for (size_t r = 0; r < dirty_runs.size(); r++) {
+                glBufferSubData(GL_ARRAY_BUFFER, dirty_runs[r].first * sizeof(struct tile_state),
+                                dirty_runs[r].second * sizeof(struct tile_state), &tiles.state[dirty_runs[r].first]);
             }
         }
-
-        if (clock() - accumilator > time_step) {
-            accumilator += time_step;
-
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // draw every face of every tile in one call
+        frame.view             = view;
+        frame.projection       = projection;
+        frame.highlight_colour = glm::vec4(0.0f, blue, 0.0f, 1.0f);
+        frame.highlight_tile   = (player_x >= 0 && player_y >= 0) ? player_x*num_tiles_y + player_y : -1;
+        frame.colour_full      = colour_full;
+        frame.time             = anim_time;
+        frame.angle_step       = angle_step;
+        frame.z_step           = z_step;
+        frame.bump_height      = bump_height;
+        frame_ubo->update(frame);
+
+        glUseProgram(shaderProgram);
+
+        glBindVertexArray(VAO_tile);
+        glDrawElementsInstanced(GL_TRIANGLES, tile_mesh_index_count, GL_UNSIGNED_INT, 0, num_tiles);
+        glBindVertexArray(0);
+
+        if (steps > 0) {
+
+            // the tile under the cursor, as drawn this frame
+            int win_width, win_height, fb_width, fb_height;
             glfwGetCursorPos(window, &mouse_x, &mouse_y);
-            mouse_x = 2 * mouse_x / SCR_WIDTH - 1;
-            mouse_y = 2 * mouse_y / SCR_HEIGHT - 1;
-
-            /// Mouse transformation goes in here. 
+            glfwGetWindowSize(window, &win_width, &win_height);
+            glfwGetFramebufferSize(window, &fb_width, &fb_height);
+            int picked = -1;
+            if (win_width > 0 && win_height > 0) {
+                TilePicker::ray cursor = TilePicker::cursor_ray(mouse_x, mouse_y, win_width, win_height,
+                                                                fb_width, fb_height, view, projection);
+                picked = picker.pick(cursor, anim_time, frame.highlight_tile);
+            }
 
-            if (fabs(mouse_x) < 1 && fabs(mouse_y) < 1) {
-                player_x_new = int(num_tiles_x * (mouse_x + 1.0f) / 2.0f);
-                player_y_new = int(num_tiles_y * (1.0f - mouse_y) / 2.0f);
+            if (picked >= 0) {
+                player_x_new = picked / num_tiles_y;
+                player_y_new = picked % num_tiles_y;
             } else {
                 player_x_new = -1;
                 player_y_new = -1;
             }
 
-            if ((player_x_new > player_x) && player_x != -1) {
-                tiles[player_x][player_y].target_rotation.x += 180.0f;
-            } else if (player_x_new < player_x) {
-                tiles[player_x][player_y].target_rotation.x -= 180.0f;
-            }
-
-            if ((player_y_new > player_y) && player_y != -1) {
-                tiles[player_x][player_y].target_rotation.y += 180.0f;
-            } else if (player_y_new < player_y) {
-                tiles[player_x][player_y].target_rotation.y -= 180.0f;
+            // flip the tile being left in the direction of travel and let its bump decay
+            if (player_x != -1 && player_y != -1 && (player_x_new != player_x || player_y_new != player_y)) {
+                unsigned int t = tiles.index(player_x, player_y);
+                glm::vec2 target = tiles.target(t);
+                if (player_x_new > player_x) {
+                    target.x += 180.0f;
+                } else if (player_x_new < player_x) {
+                    target.x -= 180.0f;
+                }
+                if (player_y_new > player_y) {
+                    target.y += 180.0f;
+                } else if (player_y_new < player_y) {
+                    target.y -= 180.0f;
+                }
+                tiles.set_target(t, target, anim_time);
+                tiles.release_bump(t, anim_time);
             }
 
             player_x = player_x_new;
@@ -415,14 +460,19 @@ int main()
         // -------------------------------------------------------------------------------
         glfwSwapBuffers(window);
         glfwPollEvents();
+        frame_clock.limit();
     }
 
     // optional: de-allocate all resources once they've outlived their purpose:
     // ------------------------------------------------------------------------
-    glDeleteVertexArrays(1, &VAO_tile_on);
-    glDeleteVertexArrays(1, &VAO_tile_off);
-    glDeleteVertexArrays(1, &VAO_tile_edge);
+    delete streamer;
+    delete frame_ubo;
+    glDeleteVertexArrays(1, &VAO_tile);
     glDeleteBuffers(1, &VBO_tile);
+    glDeleteBuffers(1, &EBO_tile);
+    glDeleteBuffers(1, &VBO_position);
+    glDeleteBuffers(1, &VBO_state);
+    glDeleteBuffers(3, VBO_colour);
 
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
@@ -456,7 +506,40 @@ void processInput(GLFWwindow *window)
 // ---------------------------------------------------------------------------------------------
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
+    (void)window;
     // make sure the viewport matches the new window dimensions; note that width and 
     // height will be significantly larger than specified on retina displays.
     glViewport(0, 0, width, height);
 }
+
+// glfw: scroll wheel zoom in streaming mode
+// ----------------------------------------
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+{
+    (void)window;
+    (void)xoffset;
+    scroll_offset += yoffset;
+}
+
+// pan and zoom the streaming camera, rates are per second
+// -------------------------------------------------------
+void stream_camera(GLFWwindow *window, TileStreamer *streamer, double seconds)
+{
+    float pan = 0.5f * (float)seconds;
+    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS)
+        streamer->pan(-pan, 0.0f);
+    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS)
+        streamer->pan(pan, 0.0f);
+    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS)
+        streamer->pan(0.0f, -pan);
+    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS)
+        streamer->pan(0.0f, pan);
+    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
+        streamer->zoom(powf(2.0f, (float)seconds));
+    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)
+        streamer->zoom(powf(0.5f, (float)seconds));
+    if (scroll_offset != 0.0) {
+        streamer->zoom(powf(0.9f, (float)scroll_offset));
+        scroll_offset = 0.0;
+    }
+}
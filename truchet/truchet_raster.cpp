@@ -0,0 +1,139 @@
+// Offline truchet renderer: draws a board at print resolution on the CPU and
+// streams it to a tiled TIFF, without needing a GPU.
+//
+//   ./truchet-raster out.tif [--size=32768] [--tiles=NX[xNY]] [--seed=N]
+//                            [--samples=S] [--threads=N]
+//
+// The board is the procedural pattern of the streaming mode (tiles.h), laid
+// out like the fixed board in truchet.cpp: a TileStore filling [-1, 1] along
+// its longer side. Image blocks are rendered in parallel a few per thread at a
+// time and written in order, so memory use only depends on the number of
+// threads, however large the image.
+
+#include <glm/glm.hpp>
+
+#include <tiles.h>
+#include <raster.h>
+#include <tiff_writer.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+
+#define RASTER_BLOCK            256
+#define RASTER_BLOCKS_PER_THREAD 4
+
+int main(int argc, char *argv[])
+{
+    std::string  path;
+    unsigned int image_size  = 8192;
+    unsigned int num_tiles_x = 64;
+    unsigned int num_tiles_y = 64;
+    uint32_t     seed        = 1;
+    int          samples     = 2;
+    unsigned int threads     = std::max(1u, std::thread::hardware_concurrency());
+
+    bool valid = true;
+    for (int a = 1; a < argc; a++) {
+        std::string arg = argv[a];
+        if (arg.compare(0, 7, "--size=") == 0) {
+            image_size = std::strtoul(arg.c_str() + 7, NULL, 10);
+        } else if (arg.compare(0, 8, "--tiles=") == 0) {
+            char *end;
+            num_tiles_x = std::strtoul(arg.c_str() + 8, &end, 10);
+            num_tiles_y = (*end == 'x') ? std::strtoul(end + 1, NULL, 10) : num_tiles_x;
+        } else if (arg.compare(0, 7, "--seed=") == 0) {
+            seed = std::strtoul(arg.c_str() + 7, NULL, 10);
+        } else if (arg.compare(0, 10, "--samples=") == 0) {
+            samples = std::atoi(arg.c_str() + 10);
+        } else if (arg.compare(0, 10, "--threads=") == 0) {
+            threads = std::strtoul(arg.c_str() + 10, NULL, 10);
+        } else if (path.empty() && arg.compare(0, 2, "--") != 0) {
+            path = arg;
+        } else {
+            valid = false;
+        }
+    }
+    if (!valid || path.empty() || image_size == 0 || num_tiles_x == 0 || num_tiles_y == 0 ||
+        samples < 1 || samples > 8 || threads == 0) {
+        std::cout << "Usage: " << argv[0] << " out.tif [--size=32768] [--tiles=NX[xNY]] [--seed=N] [--samples=1-8] [--threads=N]" << std::endl;
+        return -1;
+    }
+
+    // same layout as the fixed board in truchet.cpp, no gap between tiles
+    float tile_width = 2.0f / std::max(num_tiles_x, num_tiles_y);
+    float tile_depth = tile_width * 0.1f;
+    TileStore tiles(num_tiles_x, num_tiles_y, 240.0f, 0.2f, 0.3f);
+    for (unsigned int i = 0; i < num_tiles_x; i++) {
+        for (unsigned int j = 0; j < num_tiles_y; j++) {
+            unsigned int t = tiles.index(i, j);
+            struct tile_pattern p = tile_pattern_at(i, j, seed);
+            tiles.position[t]    = glm::vec3(tile_width * (i - (num_tiles_x - 1) / 2.0f),
+                                             tile_width * (j - (num_tiles_y - 1) / 2.0f), 0.0f);
+            tiles.colour_on[t]   = p.colour_on;
+            tiles.colour_off[t]  = tile_colour_off;
+            tiles.colour_edge[t] = tile_colour_edge;
+            tiles.set_target(t, glm::vec2(p.flip_x ? 180.0f : 0.0f, p.flip_y ? 180.0f : 0.0f), 0.0f);
+        }
+    }
+
+    // the image covers the board exactly, keeping its aspect ratio
+    glm::vec2 world_max(tile_width * num_tiles_x / 2.0f, tile_width * num_tiles_y / 2.0f);
+    unsigned int image_width  = (num_tiles_x >= num_tiles_y) ? image_size : std::max(1u, image_size * num_tiles_x / num_tiles_y);
+    unsigned int image_height = (num_tiles_x >= num_tiles_y) ? std::max(1u, image_size * num_tiles_y / num_tiles_x) : image_size;
+
+    // rendered long after the last event, so every tile has settled
+    float settled = 1.0e6f;
+    TileRasterizer raster(tiles, tile_width, tile_depth, glm::vec2(tiles.position[0]), tile_width,
+                          -world_max, world_max, image_width, image_height, settled, samples);
+
+    TiledTiffWriter tiff;
+    if (!tiff.open(path, image_width, image_height, RASTER_BLOCK)) {
+        return -1;
+    }
+
+    const size_t block_bytes = (size_t)RASTER_BLOCK * RASTER_BLOCK * 3;
+    const uint64_t block_count = tiff.tile_count();
+    const unsigned int group   = threads * RASTER_BLOCKS_PER_THREAD;
+    std::vector<unsigned char> blocks(block_bytes * group);
+    std::vector<std::vector<float> > scratch(threads);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (uint64_t first = 0; first < block_count; first += group) {
+        // the threads share out a group of blocks, then the group is written in file order
+        unsigned int count = (unsigned int)std::min<uint64_t>(group, block_count - first);
+        std::atomic<unsigned int> next(0);
+        std::vector<std::thread> workers;
+        for (unsigned int w = 0; w < threads; w++) {
+            workers.push_back(std::thread([&, w]() {
+                for (unsigned int n = next++; n < count; n = next++) {
+                    uint64_t b = first + n;
+                    raster.render_block((unsigned int)(b % tiff.tiles_across) * RASTER_BLOCK,
+                                        (unsigned int)(b / tiff.tiles_across) * RASTER_BLOCK, RASTER_BLOCK,
+                                        &blocks[n * block_bytes], scratch[w]);
+                }
+            }));
+        }
+        for (size_t w = 0; w < workers.size(); w++) {
+            workers[w].join();
+        }
+        for (unsigned int n = 0; n < count; n++) {
+            if (!tiff.write_tile(&blocks[n * block_bytes])) {
+                std::cout << "ERROR::TIFF::WRITE_FAILED " << path << std::endl;
+                return -1;
+            }
+        }
+        std::printf("\rblock %llu/%llu", (unsigned long long)(first + count), (unsigned long long)block_count);
+        std::fflush(stdout);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("\n%ux%u pixels, %ux%u tiles in %.2f s (%.1f Mpixel/s)\n", image_width, image_height,
+                num_tiles_x, num_tiles_y, seconds, image_width * (double)image_height / seconds / 1.0e6);
+    return tiff.close() ? 0 : -1;
+}
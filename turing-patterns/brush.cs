@@ -0,0 +1,49 @@
+#version 430
+layout(local_size_x = 16, local_size_y = 16) in;
+
+// Writes concentrations into a rectangle of the world. With radius <= 0 the
+// whole rectangle is filled (used to randomise the world), otherwise only a
+// disc around centre is painted. Regions that cross the edge wrap around.
+
+layout(binding = 0, rgba32f) uniform image2D conc;
+
+layout(location = 0) uniform ivec2 origin;      // first cell of the rectangle, inside the world
+layout(location = 1) uniform ivec2 regionSize;  // rectangle size in cells
+layout(location = 2) uniform uint  seed;
+layout(location = 3) uniform int   species;     // channels to write, others are zeroed
+layout(location = 4) uniform vec2  centre;      // disc centre relative to origin
+layout(location = 5) uniform float radius;
+layout(location = 6) uniform bool  randomValue; // hash noise in [0, 1) or the fixed value below
+layout(location = 7) uniform vec4  value;
+
+// PCG hash (Jarzynski & Olano, "Hash Functions for GPU Rendering")
+uint pcg(uint v)
+{
+    uint state = v * 747796405u + 2891336453u;
+    uint word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+float hash(ivec2 p, uint channel)
+{
+    return float(pcg(pcg(pcg(uint(p.x) + seed) + uint(p.y)) + channel)) / 4294967296.0;
+}
+
+void main() {
+    ivec2 offset = ivec2(gl_GlobalInvocationID.xy);
+    if (offset.x >= regionSize.x || offset.y >= regionSize.y) {
+        return;
+    }
+    if (radius > 0.0 && distance(vec2(offset) + 0.5, centre) > radius) {
+        return;
+    }
+
+    ivec2 imgSize = imageSize(conc);
+    ivec2 coords  = (origin + offset) % imgSize;
+
+    vec4 c = vec4(0.0);
+    for (int s = 0; s < species; s++) {
+        c[s] = randomValue ? hash(coords, uint(s)) : value[s];
+    }
+    imageStore(conc, coords, c);
+}
@@ -6,18 +6,65 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <shader.h>
+#include <reaction.h>
+#include <profiler.h>
+#include <frame_clock.h>
+#include <program_cache.h>
+#include <shader_reloader.h>
 
 #include <iostream>
-#include <random>
+#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <ctime>
 
 const unsigned int SCR_WIDTH  = 1024;
 const unsigned int SCR_HEIGHT = 1024;
 
-#define WORLD_WIDTH   1024
-#define WORLD_HEIGHT  1024
-float initialConcArray[WORLD_HEIGHT][WORLD_WIDTH][4];
+// World size defaults, overridden by command line:
+//   ./turing [--model=name] [--stencil=5-point|isotropic|4th-order] [--dx=spacing]
+//            [--profile=log.csv] [--vsync=on|off|adaptive] [--shaders=dir]
+//            [width] [height]
+#define WORLD_DEFAULT_WIDTH   1024
+#define WORLD_DEFAULT_HEIGHT  1024
+#define WORLD_MAX_SIZE        16384
+
+// Compute shader work group size - must match local_size_x/y in turing.cs
+#define WORK_GROUP_SIZE       32
+
+// The simulation advances STEPS_PER_TICK steps TICK_RATE times a second of
+// wall time, however many frames that is spread over
+#define TICK_RATE             60
+#define STEPS_PER_TICK        100
+
+// Ticks run in one frame after a stall; the rest of the lost time is dropped
+// so a slow frame can't queue ever more dispatches behind it
+#define MAX_TICKS_PER_FRAME   2
+
+// Work group size of brush.cs
+#define BRUSH_GROUP_SIZE      16
+
+// Mouse brush radius as a fraction of the world width, at least BRUSH_MIN_RADIUS cells
+#define BRUSH_RADIUS_FRACTION 0.02f
+#define BRUSH_MIN_RADIUS      4.0f
+
+unsigned int world_width  = WORLD_DEFAULT_WIDTH;
+unsigned int world_height = WORLD_DEFAULT_HEIGHT;
+
+// Reaction model compiled into turing.cs, see reaction.h
+std::string reaction_model = FitzHughNagumo::name();
+ReactionOptions reaction_options;
+
+// CSV timing log written by FrameProfiler, empty for none
+std::string profile_log_path;
+
+// Swap interval, see frame_clock.h
+int swap_mode = SWAP_VSYNC;
+
+// Directory holding turing.cs, brush.cs and texture.vs/fs, watched for edits
+std::string shader_dir = ".";
+int reaction_species = FitzHughNagumo::species;
 
 struct _concTextures {
     GLuint oldTextureID;
@@ -27,15 +74,28 @@ struct _concTextures {
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow* window);
 
-GLuint loadComputeShader(std::string computeShaderPath);
+GLuint loadComputeShader(std::string computeShaderPath, std::string preamble = "");
+void watchComputeShader(ShaderReloader &reloader, std::string computeShaderPath, std::string preamble, GLuint &programID);
+void watchShader(ShaderReloader &reloader, std::string vertexPath, std::string fragmentPath, Shader &shader);
+bool parseArgs(int argc, char *argv[]);
 
 struct _concTextures genConcTextures();
-void initConcTextures(struct _concTextures concTextures);
+void initConcTextures(struct _concTextures concTextures, GLuint brushProgramID);
+void paintConc(struct _concTextures concTextures, GLuint brushProgramID, double x, double y, bool randomValue);
+void dispatchBrush(GLuint brushProgramID, struct _concTextures concTextures, int x0, int y0,
+                   int width, int height, float cx, float cy, float radius, bool randomValue);
 
 bool randomize_pending = false;
+int  brush_pending     = 0;     // 0 none, 1 paint noise (left mouse), 2 erase (right mouse)
+unsigned int brush_seed;
+bool overlay_enabled   = false;
+bool o_was_pressed     = false;
 
-int main()
+int main(int argc, char *argv[])
 {
+    if (!parseArgs(argc, argv))
+        return -1;
+
     // glfw: initialize and configure
     glfwInit();
     glfwDefaultWindowHints();
@@ -63,13 +123,27 @@ int main()
         return -1;
     }
 
+    GLint maxTextureSize;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    if (world_width > (unsigned int)maxTextureSize || world_height > (unsigned int)maxTextureSize) {
+        std::cout << "World size " << world_width << "x" << world_height
+                  << " exceeds GL_MAX_TEXTURE_SIZE (" << maxTextureSize << ")" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+
     // build and compile our shader programs and texure
-    GLuint computeProgramID = loadComputeShader("turing.cs");
-    if (computeProgramID == false)
+    ReactionKernel reactionKernel;
+    findReactionKernel(reaction_model, reaction_options, reactionKernel);
+    reaction_species = reactionKernel.species;
+    GLuint computeProgramID = loadComputeShader(shader_dir + "/turing.cs", reactionKernel.preamble);
+    GLuint brushProgramID   = loadComputeShader(shader_dir + "/brush.cs");
+    if (computeProgramID == false || brushProgramID == false)
         return -1;
-    Shader ourShader("texture.vs", "texture.fs"); 
+    Shader ourShader((shader_dir + "/texture.vs").c_str(), (shader_dir + "/texture.fs").c_str());
     struct _concTextures concTextures = genConcTextures();
-    initConcTextures(concTextures);
+    brush_seed = (unsigned)time(NULL);
+    initConcTextures(concTextures, brushProgramID);
 
     glEnable(GL_DEPTH_TEST);
 
@@ -108,74 +182,107 @@ int main()
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
     glBindVertexArray(0);
 
-    srand((unsigned)time(NULL));
+    // GPU timer queries and frame statistics, toggle the overlay with O
+    FrameProfiler *profiler = new FrameProfiler();
+    if (!profiler->openLog(profile_log_path)) {
+        delete profiler;
+        glfwTerminate();
+        return -1;
+    }
+
+    // rebuild the shaders in the background when their files are edited
+    ShaderReloader *reloader = new ShaderReloader(window);
+    watchComputeShader(*reloader, shader_dir + "/turing.cs", reactionKernel.preamble, computeProgramID);
+    watchComputeShader(*reloader, shader_dir + "/brush.cs", "", brushProgramID);
+    watchShader(*reloader, shader_dir + "/texture.vs", shader_dir + "/texture.fs", ourShader);
+    reloader->start();
 
     // render loop
-    clock_t begin = clock();
-    clock_t accumilator = clock();
-    int time_step = 300;
-    int count = 0;
-
-    float dx = 1;
-    float dt = 0.0005;
-    float Da = 1;
-    float Db = 100;
-    float alpha = -0.005;
-    float beta = 10;
+    FrameClock frameClock(1.0 / TICK_RATE, MAX_TICKS_PER_FRAME);
+    frameClock.setSwapMode(swap_mode);
 
     while (!glfwWindowShouldClose(window)) {
+        int steps = frameClock.tick() * STEPS_PER_TICK;
         processInput(window);
 
+        // swap in reloaded programs before anything is dispatched this frame
+        reloader->update();
+
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        for (int i = 0; i < 100; i++) {
-            // Move 'new' data into 'old' texture
+        if (brush_pending) {
+            double mouse_x, mouse_y;
+            int win_width, win_height;
+            glfwGetCursorPos(window, &mouse_x, &mouse_y);
+            glfwGetWindowSize(window, &win_width, &win_height);
+            // the world fills the window with row 0 at the bottom
+            paintConc(concTextures, brushProgramID,
+                      world_width  * mouse_x / win_width,
+                      world_height * (1.0 - mouse_y / win_height),
+                      brush_pending == 1);
+        }
+
+        for (int i = 0; i < steps; i++) {
+            // Move 'new' data into 'old' texture, the first copy of each frame is timed on its own
+            if (i == 0)
+                profiler->copyTimer.begin();
             glCopyImageSubData(concTextures.newTextureID, GL_TEXTURE_2D, 0, 0, 0, 0,
                                concTextures.oldTextureID, GL_TEXTURE_2D, 0, 0, 0, 0,
-                               WORLD_WIDTH, WORLD_HEIGHT, 1);
+                               world_width, world_height, 1);
+            if (i == 0) {
+                profiler->copyTimer.end();
+                profiler->computeTimer.begin();
+            }
 
             // Calculate 'new' data from 'old'
+            // image units come from the layout bindings in turing.cs and the
+            // simulation parameters are compiled in by reaction.h, no uniforms to set
             glUseProgram(computeProgramID);
 
-            glUniform1i(glGetUniformLocation(computeProgramID, "oldConc"), 0);
-            glUniform1i(glGetUniformLocation(computeProgramID, "newConc"), 1);
-
-            // Set simulation parameters - TODO: does this need to happen every time?
-            glUniform1f(glGetUniformLocation(computeProgramID, "dx"),    dx);
-            glUniform1f(glGetUniformLocation(computeProgramID, "dt"),    dt);
-            glUniform1f(glGetUniformLocation(computeProgramID, "Da"),    Da);
-            glUniform1f(glGetUniformLocation(computeProgramID, "Db"),    Db);
-            glUniform1f(glGetUniformLocation(computeProgramID, "alpha"), alpha);
-            glUniform1f(glGetUniformLocation(computeProgramID, "beta"),  beta);
-
             glBindImageTexture(0, concTextures.oldTextureID, 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA32F);
             glBindImageTexture(1, concTextures.newTextureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA32F);
 
-            glDispatchCompute((GLuint)WORLD_WIDTH / 32, (GLuint)WORLD_HEIGHT / 32, 1);
+            // round up so partial work groups cover the edges - turing.cs discards the overhang
+            glDispatchCompute((world_width  + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE,
+                              (world_height + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, 1);
 
             // make sure writing to image has finished before read
             glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
-            count++;
         }
+        profiler->computeTimer.end();
 
         // render
+        profiler->drawTimer.begin();
         ourShader.use();
         glBindVertexArray(VAO); 
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, concTextures.newTextureID);
-
-        std::cout << count << std::endl;
+        profiler->drawTimer.end();
+
+        bool summaryReady = profiler->frame(frameClock.time(), 1000.0 * frameClock.frameTime(),
+                                            steps, (double)world_width * world_height);
+        if (overlay_enabled) {
+            int fbWidth, fbHeight;
+            glfwGetFramebufferSize(window, &fbWidth, &fbHeight);
+            profiler->drawOverlay(fbWidth, fbHeight);
+            if (summaryReady)
+                glfwSetWindowTitle(window, (profiler->text() + " | frame " + frameClock.pacingText()).c_str());
+        }
 
         // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
         glfwSwapBuffers(window);
         glfwPollEvents();
 
         if (randomize_pending == true) {
-            initConcTextures(concTextures);
+            initConcTextures(concTextures, brushProgramID);
             randomize_pending = false;
         }
+
+        frameClock.limit();
     }
+    delete reloader;
+    delete profiler;
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     // glfw: terminate, clearing all previously allocated GLFW resources.
@@ -191,6 +298,20 @@ void processInput(GLFWwindow *window)
     } else if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) {
         randomize_pending = true;
     }
+
+    if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS) {
+        brush_pending = 1;
+    } else if (glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS) {
+        brush_pending = 2;
+    } else {
+        brush_pending = 0;
+    }
+
+    // toggle the profiling overlay once per press
+    bool o_pressed = glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS;
+    if (o_pressed && !o_was_pressed)
+        overlay_enabled = !overlay_enabled;
+    o_was_pressed = o_pressed;
 }
 
 // glfw: whenever the window size changed (by OS or user resize) this callback function executes
@@ -214,6 +335,8 @@ struct _concTextures genConcTextures()
     // set texture filtering parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // allocate immutable storage once, contents are filled in by initConcTextures()
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32F, world_width, world_height);
     glBindTexture(GL_TEXTURE_2D, 0);
 
     glGenTextures(1, &(conc.newTextureID));
@@ -225,74 +348,170 @@ struct _concTextures genConcTextures()
     // set texture filtering parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // allocate immutable storage once, contents are filled in by initConcTextures()
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32F, world_width, world_height);
     glBindTexture(GL_TEXTURE_2D, 0);
 
     return conc;
 }
 
-void initConcTextures(struct _concTextures concTextures)
+void initConcTextures(struct _concTextures concTextures, GLuint brushProgramID)
+{
+    // fill the whole world with hashed noise on the GPU, nothing is uploaded
+    dispatchBrush(brushProgramID, concTextures, 0, 0, world_width, world_height, 0.0f, 0.0f, 0.0f, true);
+
+    // 'old' starts identical to 'new'
+    glCopyImageSubData(concTextures.newTextureID, GL_TEXTURE_2D, 0, 0, 0, 0,
+                       concTextures.oldTextureID, GL_TEXTURE_2D, 0, 0, 0, 0,
+                       world_width, world_height, 1);
+}
+
+// paint a disc of noise (or zeros) centred on world cell (x, y)
+void paintConc(struct _concTextures concTextures, GLuint brushProgramID, double x, double y, bool randomValue)
+{
+    float radius = std::max(BRUSH_MIN_RADIUS, BRUSH_RADIUS_FRACTION * world_width);
+    if (x < 0 || x >= world_width || y < 0 || y >= world_height)
+        return;
+    int size = 2 * (int)std::ceil(radius) + 1;
+    int x0   = (int)std::floor(x - radius);
+    int y0   = (int)std::floor(y - radius);
+    // only the bounding square is dispatched, no bigger than the world itself
+    dispatchBrush(brushProgramID, concTextures, x0, y0,
+                  std::min(size, (int)world_width), std::min(size, (int)world_height),
+                  x - x0, y - y0, radius, randomValue);
+}
+
+// run brush.cs over a rectangle of the 'new' texture, see brush.cs for the uniforms
+void dispatchBrush(GLuint brushProgramID, struct _concTextures concTextures, int x0, int y0,
+                   int width, int height, float cx, float cy, float radius, bool randomValue)
+{
+    // wrap the origin into the world, brush.cs wraps the rest of the rectangle
+    int w = world_width, h = world_height;
+    x0 = (x0 % w + w) % w;
+    y0 = (y0 % h + h) % h;
+
+    glUseProgram(brushProgramID);
+    glUniform2i(0, x0, y0);
+    glUniform2i(1, width, height);
+    glUniform1ui(2, brush_seed++);
+    glUniform1i(3, reaction_species);
+    glUniform2f(4, cx, cy);
+    glUniform1f(5, radius);
+    glUniform1i(6, randomValue);
+    glUniform4f(7, 0.0f, 0.0f, 0.0f, 0.0f);
+
+    glBindImageTexture(0, concTextures.newTextureID, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA32F);
+    glDispatchCompute((width  + BRUSH_GROUP_SIZE - 1) / BRUSH_GROUP_SIZE,
+                      (height + BRUSH_GROUP_SIZE - 1) / BRUSH_GROUP_SIZE, 1);
+
+    // the next step copies 'new' into 'old' and reads it as an image
+    glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+// read optional reaction model, world width and height from the command line
+bool parseArgs(int argc, char *argv[])
 {
-    // Creare 2D array of vec4s to store intial values of 
-    for (int y = 0; y < WORLD_HEIGHT; y++) {
-        for (int x = 0; x < WORLD_WIDTH; x++) {
-            initialConcArray[y][x][0] = static_cast <float> (rand()) / static_cast <float> (RAND_MAX); // initial 'A' value
-            initialConcArray[y][x][1] = static_cast <float> (rand()) / static_cast <float> (RAND_MAX); // initial 'B' value
-            initialConcArray[y][x][2] = 0.0f;
-            initialConcArray[y][x][3] = 0.0f;
+    const std::string modelOption   = "--model=";
+    const std::string stencilOption = "--stencil=";
+    const std::string dxOption      = "--dx=";
+    const std::string profileOption = "--profile=";
+    const std::string vsyncOption   = "--vsync=";
+    const std::string shadersOption = "--shaders=";
+    std::vector<std::string> sizes;
+    bool valid = true;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.compare(0, modelOption.size(), modelOption) == 0) {
+            reaction_model = arg.substr(modelOption.size());
+        } else if (arg.compare(0, stencilOption.size(), stencilOption) == 0) {
+            valid = valid && parseStencil(arg.substr(stencilOption.size()), reaction_options.stencil);
+        } else if (arg.compare(0, dxOption.size(), dxOption) == 0) {
+            reaction_options.dx = std::strtof(arg.substr(dxOption.size()).c_str(), NULL);
+            valid = valid && reaction_options.dx > 0.0f;
+        } else if (arg.compare(0, profileOption.size(), profileOption) == 0) {
+            profile_log_path = arg.substr(profileOption.size());
+        } else if (arg.compare(0, vsyncOption.size(), vsyncOption) == 0) {
+            valid = valid && FrameClock::parseSwapMode(arg.substr(vsyncOption.size()), swap_mode);
+        } else if (arg.compare(0, shadersOption.size(), shadersOption) == 0) {
+            shader_dir = arg.substr(shadersOption.size());
+            valid = valid && !shader_dir.empty();
+        } else {
+            sizes.push_back(arg);
         }
     }
-    glBindTexture(GL_TEXTURE_2D, concTextures.newTextureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, WORLD_WIDTH, WORLD_HEIGHT, 0, GL_RGBA, GL_FLOAT, initialConcArray);
-    glBindTexture(GL_TEXTURE_2D, concTextures.oldTextureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, WORLD_WIDTH, WORLD_HEIGHT, 0, GL_RGBA, GL_FLOAT, initialConcArray);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    ReactionKernel kernel;
+    if (!valid || sizes.size() > 2 || !findReactionKernel(reaction_model, reaction_options, kernel)) {
+        std::cout << "Usage: " << argv[0] << " [--model=name] [--stencil=5-point|isotropic|4th-order] [--dx=spacing] [--profile=log.csv] [--vsync=on|off|adaptive] [--shaders=dir] [width] [height]\n"
+                  << "Models: " << FitzHughNagumo::name() << ", " << GrayScott::name() << ", "
+                  << Brusselator::name() << ", " << Schnakenberg::name() << std::endl;
+        return false;
+    }
+    if (sizes.size() > 0) {
+        world_width  = std::strtoul(sizes[0].c_str(), NULL, 10);
+        world_height = (sizes.size() > 1) ? std::strtoul(sizes[1].c_str(), NULL, 10) : world_width;
+    }
+    if (world_width  == 0 || world_width  > WORLD_MAX_SIZE ||
+        world_height == 0 || world_height > WORLD_MAX_SIZE) {
+        std::cout << "World size must be between 1 and " << WORLD_MAX_SIZE << " in each dimension" << std::endl;
+        return false;
+    }
+    return true;
 }
 
-GLuint loadComputeShader(std::string computeShaderPath)
+GLuint loadComputeShader(std::string computeShaderPath, std::string preamble)
 {
     std::ifstream     computeShaderFile;
     std::stringstream computeShaderStream;
-    std::string       computeShaderCode;
-    const char*       computeShaderString;
-
-    int success;
-    char infoLog[512];
-
-    GLuint programID = glCreateProgram();
-    GLuint computeShaderID = glCreateShader(GL_COMPUTE_SHADER);
 
     // open and read file
     computeShaderFile.open(computeShaderPath);
+    if (!computeShaderFile.is_open())
+    {
+        std::cout << "ERROR::SHADER::COMPUTE::FILE_NOT_SUCCESFULLY_READ " << computeShaderPath << std::endl;
+        return false;
+    }
     computeShaderStream << computeShaderFile.rdbuf();
     computeShaderFile.close();
 
-    // convert stream into string
-    computeShaderCode   = computeShaderStream.str();
-    computeShaderString = computeShaderCode.c_str();
-
-    // compile compute shader
-    glShaderSource(computeShaderID, 1, &computeShaderString, NULL);
-    glCompileShader(computeShaderID);
-    glGetShaderiv(computeShaderID, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(computeShaderID, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::COMPUTE::COMPILATION_FAILED\n" << infoLog << std::endl;
-        return false;
-    };
+    // compile and link, unless the same source was built by this driver before
+    std::vector<ProgramStage> stages;
+    stages.push_back(ProgramStage(GL_COMPUTE_SHADER, insertPreamble(computeShaderStream.str(), preamble)));
+    return ProgramCache::shared().build(stages, "COMPUTE");
+}
 
-    // link compute shader
-    glAttachShader(programID, computeShaderID);
-    glLinkProgram(programID);
-    glGetProgramiv(programID, GL_LINK_STATUS, &success);
-    if (!success)
-    {
-        glGetProgramInfoLog(programID, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::COMPUTE::LINKING_FAILED\n" << infoLog << std::endl;
-        return false;
-    }
+// rebuild a compute shader loaded with loadComputeShader() when its file changes
+void watchComputeShader(ShaderReloader &reloader, std::string computeShaderPath, std::string preamble, GLuint &programID)
+{
+    reloader.watch(std::vector<std::string>(1, computeShaderPath), "COMPUTE",
+        [computeShaderPath, preamble](std::vector<ProgramStage> &stages) {
+            std::string source;
+            if (!ShaderReloader::readFile(computeShaderPath, source))
+                return false;
+            stages.push_back(ProgramStage(GL_COMPUTE_SHADER, insertPreamble(source, preamble)));
+            return true;
+        },
+        [&programID](GLuint program) {
+            glDeleteProgram(programID);
+            programID = program;
+        });
+}
 
-    glDeleteShader(computeShaderID);
-    
-    return programID;
-}
\ No newline at end of file
+// rebuild a vertex/fragment Shader when either file changes
+void watchShader(ShaderReloader &reloader, std::string vertexPath, std::string fragmentPath, Shader &shader)
+{
+    std::vector<std::string> files;
+    files.push_back(vertexPath);
+    files.push_back(fragmentPath);
+    reloader.watch(files, "PROGRAM",
+        [vertexPath, fragmentPath](std::vector<ProgramStage> &stages) {
+            std::string vertexCode, fragmentCode;
+            if (!ShaderReloader::readFile(vertexPath, vertexCode) || !ShaderReloader::readFile(fragmentPath, fragmentCode))
+                return false;
+            stages.push_back(ProgramStage(GL_VERTEX_SHADER, vertexCode));
+            stages.push_back(ProgramStage(GL_FRAGMENT_SHADER, fragmentCode));
+            return true;
+        },
+        [&shader](GLuint program) {
+            shader.adopt(program);
+        });
+}
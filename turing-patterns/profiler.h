@@ -0,0 +1,227 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+// Ring of GL_TIME_ELAPSED queries for one section of the frame. Results are
+// collected a few frames later once they are available, so reading them
+// never stalls the pipeline.
+class GpuTimer
+{
+public:
+    static const int RING_SIZE = 4;
+
+    GpuTimer() : current(0), active(false), lastMs(0.0)
+    {
+        glGenQueries(RING_SIZE, queries);
+        for (int i = 0; i < RING_SIZE; i++)
+            pending[i] = false;
+    }
+    ~GpuTimer()
+    {
+        glDeleteQueries(RING_SIZE, queries);
+    }
+    GpuTimer(const GpuTimer &) = delete;
+    GpuTimer &operator=(const GpuTimer &) = delete;
+
+    // start timing, skipped if the slot's previous result is still in flight
+    void begin()
+    {
+        collect();
+        active = !pending[current];
+        if (active)
+            glBeginQuery(GL_TIME_ELAPSED, queries[current]);
+    }
+    void end()
+    {
+        if (!active)
+            return;
+        glEndQuery(GL_TIME_ELAPSED);
+        active = false;
+        pending[current] = true;
+        current = (current + 1) % RING_SIZE;
+    }
+
+    // most recent completed measurement in milliseconds
+    double ms()
+    {
+        collect();
+        return lastMs;
+    }
+
+private:
+    GLuint queries[RING_SIZE];
+    bool   pending[RING_SIZE];
+    int    current;
+    bool   active;
+    double lastMs;
+
+    void collect()
+    {
+        // oldest first, so lastMs ends up holding the newest result
+        for (int n = 0; n < RING_SIZE; n++) {
+            int i = (current + n) % RING_SIZE;
+            if (!pending[i])
+                continue;
+            GLint available = 0;
+            glGetQueryObjectiv(queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                continue;
+            GLuint64 ns;
+            glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &ns);
+            lastMs = ns / 1.0e6;
+            pending[i] = false;
+        }
+    }
+};
+
+// Per-frame CPU and GPU timings averaged over a logging interval, written as
+// CSV and optionally drawn as bars over the simulation.
+//
+// The copy is timed on its own for the first step of each frame and scaled up
+// by the number of steps; the rest of the step loop is timed as compute.
+class FrameProfiler
+{
+public:
+    GpuTimer copyTimer;
+    GpuTimer computeTimer;
+    GpuTimer drawTimer;
+
+    FrameProfiler(double logInterval = 1.0) : interval(logInterval)
+    {
+        reset();
+    }
+
+    // open a CSV log, an empty path disables logging
+    bool openLog(const std::string &path)
+    {
+        if (path.empty())
+            return true;
+        csv.open(path);
+        if (!csv.is_open()) {
+            std::cout << "ERROR::PROFILER::CANNOT_OPEN_LOG " << path << std::endl;
+            return false;
+        }
+        csv << "time_s,frames,cpu_frame_ms,cpu_frame_max_ms,gpu_compute_ms,gpu_copy_ms,gpu_draw_ms,cells_per_sec" << std::endl;
+        return true;
+    }
+
+    // record one frame; returns true when a new interval summary is ready
+    bool frame(double now, double cpuFrameMs, int steps, double cellsPerStep)
+    {
+        if (intervalStart < 0.0)
+            intervalStart = now;
+        frames++;
+        cpuMs    += cpuFrameMs;
+        cpuMaxMs  = std::max(cpuMaxMs, cpuFrameMs);
+        // computeTimer also covers the copies of steps 2..n; frames that ran
+        // no steps leave both timers holding an older frame's result
+        if (steps > 0) {
+            double copyStepMs = copyTimer.ms();
+            copySumMs    += copyStepMs * steps;
+            computeSumMs += std::max(0.0, computeTimer.ms() - copyStepMs * (steps - 1));
+        }
+        drawSumMs    += drawTimer.ms();
+        cells        += cellsPerStep * steps;
+
+        if (now - intervalStart < interval)
+            return false;
+
+        double elapsed = now - intervalStart;
+        summary.frames      = frames;
+        summary.cpuMs       = cpuMs / frames;
+        summary.cpuMaxMs    = cpuMaxMs;
+        summary.computeMs   = computeSumMs / frames;
+        summary.copyMs      = copySumMs / frames;
+        summary.drawMs      = drawSumMs / frames;
+        summary.cellsPerSec = cells / elapsed;
+        if (csv.is_open()) {
+            csv << std::fixed << std::setprecision(3) << now << "," << frames << ","
+                << summary.cpuMs << "," << summary.cpuMaxMs << ","
+                << summary.computeMs << "," << summary.copyMs << "," << summary.drawMs << ","
+                << std::scientific << summary.cellsPerSec << std::endl;
+        }
+        reset();
+        intervalStart = now;
+        return true;
+    }
+
+    // one line summary of the last interval, e.g. for the window title
+    std::string text() const
+    {
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(2)
+          << "cpu " << summary.cpuMs << " ms | compute " << summary.computeMs
+          << " ms | copy " << summary.copyMs << " ms | draw " << summary.drawMs << " ms | "
+          << std::setprecision(1) << summary.cellsPerSec / 1.0e9 << " Gcells/s";
+        return s.str();
+    }
+
+    // bars along the bottom of the framebuffer scaled to budgetMs across the
+    // full width: compute (red), copy (yellow), draw (green) and CPU (white)
+    void drawOverlay(int width, int height, double budgetMs = 1000.0 / 60.0) const
+    {
+        GLfloat clearColour[4];
+        glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColour);
+        glEnable(GL_SCISSOR_TEST);
+
+        int barHeight = std::max(4, height / 100);
+        double scale  = width / budgetMs;
+        int x = 0;
+        x = bar(x, 0, summary.computeMs * scale, barHeight, 0.9f, 0.2f, 0.2f);
+        x = bar(x, 0, summary.copyMs    * scale, barHeight, 0.9f, 0.9f, 0.2f);
+        x = bar(x, 0, summary.drawMs    * scale, barHeight, 0.2f, 0.9f, 0.2f);
+        bar(0, barHeight, summary.cpuMs * scale, barHeight, 1.0f, 1.0f, 1.0f);
+
+        glDisable(GL_SCISSOR_TEST);
+        glClearColor(clearColour[0], clearColour[1], clearColour[2], clearColour[3]);
+    }
+
+private:
+    struct Summary {
+        int    frames      = 0;
+        double cpuMs       = 0.0;
+        double cpuMaxMs    = 0.0;
+        double computeMs   = 0.0;
+        double copyMs      = 0.0;
+        double drawMs      = 0.0;
+        double cellsPerSec = 0.0;
+    };
+
+    double        interval;
+    double        intervalStart = -1.0;
+    int           frames;
+    double        cpuMs, cpuMaxMs;
+    double        computeSumMs, copySumMs, drawSumMs;
+    double        cells;
+    Summary       summary;
+    std::ofstream csv;
+
+    void reset()
+    {
+        frames = 0;
+        cpuMs = cpuMaxMs = 0.0;
+        computeSumMs = copySumMs = drawSumMs = 0.0;
+        cells = 0.0;
+    }
+
+    static int bar(int x, int y, double w, int h, float r, float g, float b)
+    {
+        int pixels = (int)w;
+        if (pixels > 0) {
+            glScissor(x, y, pixels, h);
+            glClearColor(r, g, b, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+        return x + std::max(pixels, 0);
+    }
+};
+
+#endif
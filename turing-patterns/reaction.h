@@ -0,0 +1,311 @@
+#ifndef REACTION_H
+#define REACTION_H
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+// Reaction-diffusion models for up to 4 species, stored in the rgba channels
+// of the concentration textures as a, b, c and d.
+//
+// Each reaction term is written once as an expression that is valid in both
+// C++ and GLSL. REACTION_TERMS_N, for N = 1 to 4 species, turns them into an
+// inline react() for the CPU kernel and strings for the compute shader
+// preamble, where the model's parameters are emitted as consts so the GLSL
+// compiler folds them.
+
+// Laplacian stencils available to turing.cs and reactionDiffusionStep()
+#define STENCIL_5_POINT     0
+#define STENCIL_ISOTROPIC   1
+#define STENCIL_4TH_ORDER   2
+
+struct ReactionParam {
+    const char *name;
+    float       value;
+};
+
+#define REACTION_SPECIES_VARS                                                   \
+    const float a = conc[0], b = conc[1], c = conc[2], d = conc[3];             \
+    (void)a; (void)b; (void)c; (void)d;
+
+#define REACTION_TERMS_1(ra)                                                    \
+    static const int species = 1;                                               \
+    static const char *term(int i)                                              \
+    { static const char *const t[] = { #ra }; return t[i]; }                    \
+    void react(const float *conc, float *r) const                               \
+    { REACTION_SPECIES_VARS r[0] = (ra); }
+
+#define REACTION_TERMS_2(ra, rb)                                                \
+    static const int species = 2;                                               \
+    static const char *term(int i)                                              \
+    { static const char *const t[] = { #ra, #rb }; return t[i]; }               \
+    void react(const float *conc, float *r) const                               \
+    { REACTION_SPECIES_VARS r[0] = (ra); r[1] = (rb); }
+
+#define REACTION_TERMS_3(ra, rb, rc)                                            \
+    static const int species = 3;                                               \
+    static const char *term(int i)                                              \
+    { static const char *const t[] = { #ra, #rb, #rc }; return t[i]; }          \
+    void react(const float *conc, float *r) const                               \
+    { REACTION_SPECIES_VARS r[0] = (ra); r[1] = (rb); r[2] = (rc); }
+
+#define REACTION_TERMS_4(ra, rb, rc, rd)                                        \
+    static const int species = 4;                                               \
+    static const char *term(int i)                                              \
+    { static const char *const t[] = { #ra, #rb, #rc, #rd }; return t[i]; }     \
+    void react(const float *conc, float *r) const                               \
+    { REACTION_SPECIES_VARS r[0] = (ra); r[1] = (rb); r[2] = (rc); r[3] = (rd); }
+
+// ----------------------------------------------------------------------------
+// Built in models. Each provides its name, grid spacing, time step, diffusion
+// coefficients, parameter list and reaction terms.
+// ----------------------------------------------------------------------------
+
+// The original turing.cs model
+struct FitzHughNagumo {
+    static const char *name() { return "fitzhugh-nagumo"; }
+    float dx = 1.0f;
+    float dt = 0.0005f;
+    float D[4] = { 1.0f, 100.0f, 0.0f, 0.0f };
+
+    float alpha = -0.005f;
+    float beta  = 10.0f;
+    std::vector<ReactionParam> params() const { return { {"alpha", alpha}, {"beta", beta} }; }
+
+    REACTION_TERMS_2(a - a*a*a - b + alpha,
+                     beta * (a - b))
+};
+
+struct GrayScott {
+    static const char *name() { return "gray-scott"; }
+    float dx = 1.0f;
+    float dt = 1.0f;
+    float D[4] = { 0.16f, 0.08f, 0.0f, 0.0f };
+
+    float F = 0.035f;
+    float k = 0.065f;
+    std::vector<ReactionParam> params() const { return { {"F", F}, {"k", k} }; }
+
+    REACTION_TERMS_2(-a*b*b + F * (1.0f - a),
+                     a*b*b - (F + k) * b)
+};
+
+struct Brusselator {
+    static const char *name() { return "brusselator"; }
+    float dx = 1.0f;
+    float dt = 0.005f;
+    float D[4] = { 1.0f, 8.0f, 0.0f, 0.0f };
+
+    float A = 4.5f;
+    float B = 6.96f;
+    std::vector<ReactionParam> params() const { return { {"A", A}, {"B", B} }; }
+
+    REACTION_TERMS_2(A - (B + 1.0f) * a + a*a*b,
+                     B * a - a*a*b)
+};
+
+struct Schnakenberg {
+    static const char *name() { return "schnakenberg"; }
+    float dx = 1.0f;
+    float dt = 0.005f;
+    float D[4] = { 1.0f, 40.0f, 0.0f, 0.0f };
+
+    float alpha = 0.1f;
+    float beta  = 0.9f;
+    std::vector<ReactionParam> params() const { return { {"alpha", alpha}, {"beta", beta} }; }
+
+    REACTION_TERMS_2(alpha - a + a*a*b,
+                     beta - a*a*b)
+};
+
+// ----------------------------------------------------------------------------
+// Shader generation
+// ----------------------------------------------------------------------------
+
+struct ReactionKernel {
+    std::string name;
+    int         species;
+    std::string preamble;
+};
+
+// Overrides applied on top of a model's defaults
+struct ReactionOptions {
+    int   stencil = STENCIL_5_POINT;
+    float dx      = 0.0f;   // 0 keeps the model's grid spacing
+};
+
+// parse a stencil name from the command line, returns false if it is unknown
+inline bool parseStencil(const std::string &name, int &stencil)
+{
+    if (name == "5-point") {
+        stencil = STENCIL_5_POINT;
+    } else if (name == "isotropic") {
+        stencil = STENCIL_ISOTROPIC;
+    } else if (name == "4th-order") {
+        stencil = STENCIL_4TH_ORDER;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+inline std::string glslFloat(float value)
+{
+    std::ostringstream s;
+    s << std::showpoint << std::setprecision(9) << value;
+    return s.str();
+}
+
+// GLSL inserted after the #version line of turing.cs: SPECIES, STENCIL, dx,
+// dt, D, the model parameters and reaction()
+template <class Model>
+std::string generateReactionPreamble(const Model &model, int stencil)
+{
+    std::ostringstream s;
+    s << "#define SPECIES " << Model::species << "\n";
+    s << "#define STENCIL_5_POINT "   << STENCIL_5_POINT   << "\n";
+    s << "#define STENCIL_ISOTROPIC " << STENCIL_ISOTROPIC << "\n";
+    s << "#define STENCIL_4TH_ORDER " << STENCIL_4TH_ORDER << "\n";
+    s << "#define STENCIL " << stencil << "\n";
+    s << "const float dx = " << glslFloat(model.dx) << ";\n";
+    s << "const float dt = " << glslFloat(model.dt) << ";\n";
+    s << "const vec4 D = vec4(" << glslFloat(model.D[0]) << ", " << glslFloat(model.D[1]) << ", "
+      << glslFloat(model.D[2]) << ", " << glslFloat(model.D[3]) << ");\n";
+    std::vector<ReactionParam> params = model.params();
+    for (size_t i = 0; i < params.size(); i++) {
+        s << "const float " << params[i].name << " = " << glslFloat(params[i].value) << ";\n";
+    }
+    s << "vec4 reaction(vec4 conc)\n{\n";
+    s << "    float a = conc.x, b = conc.y, c = conc.z, d = conc.w;\n";
+    s << "    vec4 r = vec4(0.0);\n";
+    for (int i = 0; i < Model::species; i++) {
+        s << "    r[" << i << "] = " << Model::term(i) << ";\n";
+    }
+    s << "    return r;\n}\n";
+    return s.str();
+}
+
+// largest eigenvalue magnitude of each stencil's Laplacian, times dx^2
+inline float stencilEigenvalueBound(int stencil)
+{
+    if (stencil == STENCIL_ISOTROPIC) {
+        return 16.0f / 3.0f;
+    } else if (stencil == STENCIL_4TH_ORDER) {
+        return 32.0f / 3.0f;
+    }
+    return 8.0f;
+}
+
+// Apply the options to a model. Explicit Euler diffusion is stable while
+// dt * D * lambda <= 2, so the model's dt is clamped to 90% of that limit
+// for the chosen stencil, dx and fastest diffusing species.
+template <class Model>
+void applyReactionOptions(Model &model, const ReactionOptions &options)
+{
+    if (options.dx > 0.0f)
+        model.dx = options.dx;
+    float maxD = 0.0f;
+    for (int s = 0; s < Model::species; s++) {
+        maxD = std::max(maxD, model.D[s]);
+    }
+    if (maxD > 0.0f) {
+        float limit = 1.8f * model.dx * model.dx / (stencilEigenvalueBound(options.stencil) * maxD);
+        model.dt = std::min(model.dt, limit);
+    }
+}
+
+template <class Model>
+ReactionKernel makeReactionKernel(Model model, const ReactionOptions &options)
+{
+    applyReactionOptions(model, options);
+    ReactionKernel kernel;
+    kernel.name     = Model::name();
+    kernel.species  = Model::species;
+    kernel.preamble = generateReactionPreamble(model, options.stencil);
+    return kernel;
+}
+
+// look up a built in model by name, returns false if it is unknown
+inline bool findReactionKernel(const std::string &name, const ReactionOptions &options, ReactionKernel &kernel)
+{
+    if (name == FitzHughNagumo::name()) {
+        kernel = makeReactionKernel(FitzHughNagumo(), options);
+    } else if (name == GrayScott::name()) {
+        kernel = makeReactionKernel(GrayScott(), options);
+    } else if (name == Brusselator::name()) {
+        kernel = makeReactionKernel(Brusselator(), options);
+    } else if (name == Schnakenberg::name()) {
+        kernel = makeReactionKernel(Schnakenberg(), options);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// insert generated code after the #version directive of a shader source
+inline std::string insertPreamble(const std::string &source, const std::string &preamble)
+{
+    size_t lineEnd = source.find('\n', source.find("#version"));
+    if (lineEnd == std::string::npos)
+        return source;
+    return source.substr(0, lineEnd + 1) + preamble + source.substr(lineEnd + 1);
+}
+
+// ----------------------------------------------------------------------------
+// CPU kernel
+// ----------------------------------------------------------------------------
+
+// Laplacian of species s at column x, rows[] and cols[] hold the wrapped
+// neighbours at offsets -2..2
+template <int Stencil>
+inline float laplacian(const float *const rows[5], const unsigned int cols[5], int s, float invDx2)
+{
+    float p11  = rows[2][cols[2]*4 + s];
+    float near = rows[2][cols[1]*4 + s] + rows[2][cols[3]*4 + s] + rows[1][cols[2]*4 + s] + rows[3][cols[2]*4 + s];
+    if (Stencil == STENCIL_ISOTROPIC) {
+        float corners = rows[1][cols[1]*4 + s] + rows[1][cols[3]*4 + s] + rows[3][cols[1]*4 + s] + rows[3][cols[3]*4 + s];
+        return (4.0f * near + corners - 20.0f * p11) * invDx2 / 6.0f;
+    } else if (Stencil == STENCIL_4TH_ORDER) {
+        float far = rows[2][cols[0]*4 + s] + rows[2][cols[4]*4 + s] + rows[0][cols[2]*4 + s] + rows[4][cols[2]*4 + s];
+        return (16.0f * near - far - 60.0f * p11) * invDx2 / 12.0f;
+    }
+    return (near - 4.0f * p11) * invDx2;
+}
+
+// One explicit Euler step of the same scheme as turing.cs on an rgba float
+// world with periodic edges. Species beyond Model::species are copied.
+template <int Stencil, class Model>
+void reactionDiffusionStep(const Model &model, const float *oldConc, float *newConc,
+                           unsigned int width, unsigned int height)
+{
+    const float invDx2 = 1.0f / (model.dx * model.dx);
+    for (unsigned int y = 0; y < height; y++) {
+        const float *rows[5];
+        for (int k = 0; k < 5; k++) {
+            rows[k] = oldConc + (size_t)((y + 2 * height + k - 2) % height) * width * 4;
+        }
+        for (unsigned int x = 0; x < width; x++) {
+            unsigned int cols[5];
+            for (int k = 0; k < 5; k++) {
+                cols[k] = (x + 2 * width + k - 2) % width;
+            }
+            const float *p11 = rows[2] + x * 4;
+            float *out = newConc + ((size_t)y * width + x) * 4;
+
+            float r[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            model.react(p11, r);
+            for (int s = 0; s < 4; s++) {
+                if (s < Model::species) {
+                    float L = laplacian<Stencil>(rows, cols, s, invDx2);
+                    out[s] = p11[s] + model.dt * (model.D[s] * L + r[s]);
+                } else {
+                    out[s] = p11[s];
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,297 @@
+#include <reaction.h>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+
+// Checks the CPU reference step in reaction.h. turing.cs implements the same
+// scheme, so these pin down what every stencil and model is expected to do.
+
+// Diffusion only, so a single step spreads a spike by the stencil weights
+struct PureDiffusion {
+    static const char *name() { return "pure-diffusion"; }
+    float dx = 1.0f;
+    float dt = 0.01f;
+    float D[4] = { 1.0f, 2.0f, 0.0f, 0.0f };
+    std::vector<ReactionParam> params() const { return {}; }
+
+    REACTION_TERMS_2(0.0f * a, 0.0f * b)
+};
+
+// Small linear models for the species counts the built in models don't use,
+// with terms that mix every channel so a swapped index shows up
+struct Decay1 {
+    static const char *name() { return "decay-1"; }
+    float dx = 1.0f;
+    float dt = 0.05f;
+    float D[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    float k = 0.5f;
+    std::vector<ReactionParam> params() const { return { {"k", k} }; }
+
+    REACTION_TERMS_1(-k * a)
+};
+
+struct Cycle3 {
+    static const char *name() { return "cycle-3"; }
+    float dx = 1.0f;
+    float dt = 0.05f;
+    float D[4] = { 1.0f, 0.5f, 0.25f, 0.0f };
+    float k = 0.5f;
+    std::vector<ReactionParam> params() const { return { {"k", k} }; }
+
+    REACTION_TERMS_3(k * (c - a),
+                     k * (a - 2.0f * b),
+                     k * (b - 3.0f * c))
+};
+
+struct Cycle4 {
+    static const char *name() { return "cycle-4"; }
+    float dx = 1.0f;
+    float dt = 0.05f;
+    float D[4] = { 1.0f, 0.5f, 0.25f, 0.125f };
+    float k = 0.5f;
+    std::vector<ReactionParam> params() const { return { {"k", k} }; }
+
+    REACTION_TERMS_4(k * (d - a),
+                     k * (a - 2.0f * b),
+                     k * (b - 3.0f * c),
+                     k * (c - 4.0f * d))
+};
+
+static bool near(float a, float b, float tolerance)
+{
+    return std::fabs(a - b) <= tolerance;
+}
+
+// value of species s at (x, y) of an rgba world
+static float at(const std::vector<float> &conc, unsigned int width, unsigned int x, unsigned int y, int s)
+{
+    return conc[((size_t)y * width + x) * 4 + s];
+}
+
+// a uniform world has no diffusion, so one step is exactly the reaction
+template <int Stencil, class Model>
+static int testUniform(const Model &model)
+{
+    const unsigned int width = 8, height = 6;
+    const float start[4] = { 0.7f, 0.3f, 0.25f, 0.5f };
+    std::vector<float> oldConc(width * height * 4), newConc(width * height * 4);
+    for (size_t i = 0; i < oldConc.size(); i++) {
+        oldConc[i] = start[i % 4];
+    }
+    float r[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    model.react(start, r);
+
+    reactionDiffusionStep<Stencil>(model, oldConc.data(), newConc.data(), width, height);
+
+    int errors = 0;
+    for (size_t i = 0; i < newConc.size(); i++) {
+        int s = i % 4;
+        float expected = s < Model::species ? start[s] + model.dt * r[s] : start[s];
+        if (!near(newConc[i], expected, 1e-6f)) {
+            errors++;
+        }
+    }
+    if (errors) {
+        std::cout << Model::name() << " stencil " << Stencil << ": uniform world changed by diffusion\n";
+    }
+    return errors;
+}
+
+// a spike at the corner spreads across the periodic edges with the stencil
+// weights and keeps its mass
+template <int Stencil>
+static int testSpike(const float *weights, float scale)
+{
+    const unsigned int width = 7, height = 9;
+    PureDiffusion model;
+    std::vector<float> oldConc(width * height * 4, 0.0f), newConc(width * height * 4);
+    oldConc[0] = 1.0f;
+    oldConc[1] = 1.0f;
+
+    reactionDiffusionStep<Stencil>(model, oldConc.data(), newConc.data(), width, height);
+
+    int errors = 0;
+    for (int s = 0; s < 2; s++) {
+        float total = 0.0f;
+        for (unsigned int y = 0; y < height; y++) {
+            for (unsigned int x = 0; x < width; x++) {
+                // offsets from the spike, wrapped into -2..2 where the stencil reaches
+                int ox = (int)x > (int)width  / 2 ? (int)x - (int)width  : (int)x;
+                int oy = (int)y > (int)height / 2 ? (int)y - (int)height : (int)y;
+                float w = 0.0f;
+                if (std::abs(ox) <= 2 && std::abs(oy) <= 2) {
+                    w = weights[(oy + 2) * 5 + ox + 2] / scale;
+                }
+                float expected = (ox == 0 && oy == 0 ? 1.0f : 0.0f) + model.dt * model.D[s] * w;
+                float value = at(newConc, width, x, y, s);
+                if (!near(value, expected, 1e-6f)) {
+                    errors++;
+                }
+                total += value;
+            }
+        }
+        if (!near(total, 1.0f, 1e-5f)) {
+            errors++;
+        }
+    }
+    if (errors) {
+        std::cout << "stencil " << Stencil << ": spike does not spread by the stencil weights\n";
+    }
+    return errors;
+}
+
+static int testStencils()
+{
+    static const float fivePoint[25] = {
+        0,  0,  0,  0, 0,
+        0,  0,  1,  0, 0,
+        0,  1, -4,  1, 0,
+        0,  0,  1,  0, 0,
+        0,  0,  0,  0, 0,
+    };
+    static const float isotropic[25] = {
+        0,  0,   0,  0, 0,
+        0,  1,   4,  1, 0,
+        0,  4, -20,  4, 0,
+        0,  1,   4,  1, 0,
+        0,  0,   0,  0, 0,
+    };
+    static const float fourthOrder[25] = {
+         0,  0,  -1,  0,  0,
+         0,  0,  16,  0,  0,
+        -1, 16, -60, 16, -1,
+         0,  0,  16,  0,  0,
+         0,  0,  -1,  0,  0,
+    };
+
+    int errors = 0;
+    errors += testSpike<STENCIL_5_POINT>(fivePoint, 1.0f);
+    errors += testSpike<STENCIL_ISOTROPIC>(isotropic, 6.0f);
+    errors += testSpike<STENCIL_4TH_ORDER>(fourthOrder, 12.0f);
+    return errors;
+}
+
+// steps a noisy world like the one brush.cs starts from and checks the
+// fields stay finite with the time step the stencil allows
+template <int Stencil, class Model>
+static int testStable(Model model)
+{
+    const unsigned int width = 64, height = 64, steps = 2000;
+    ReactionOptions options;
+    options.stencil = Stencil;
+    applyReactionOptions(model, options);
+
+    std::vector<float> oldConc(width * height * 4, 0.0f), newConc(width * height * 4);
+    unsigned int state = 12345u;
+    for (size_t i = 0; i < oldConc.size(); i++) {
+        state = state * 1664525u + 1013904223u;
+        if ((int)(i % 4) < Model::species) {
+            oldConc[i] = (state >> 8) / 16777216.0f;
+        }
+    }
+    for (unsigned int i = 0; i < steps; i++) {
+        reactionDiffusionStep<Stencil>(model, oldConc.data(), newConc.data(), width, height);
+        oldConc.swap(newConc);
+    }
+
+    int errors = 0;
+    for (size_t i = 0; i < oldConc.size(); i++) {
+        if (!std::isfinite(oldConc[i])) {
+            errors++;
+        }
+    }
+    if (errors) {
+        std::cout << Model::name() << " stencil " << Stencil << ": " << errors
+                  << " values are not finite after " << steps << " steps of dt " << model.dt << "\n";
+    }
+    return errors;
+}
+
+// react() and the shader preamble cover exactly Model::species channels and
+// agree with the expected values and term strings
+template <class Model>
+static int testTerms(const Model &model, const float *expected, const char *const *terms)
+{
+    const float conc[4] = { 0.5f, 0.125f, 2.0f, 4.0f };
+    float r[4] = { 7.0f, 7.0f, 7.0f, 7.0f };
+    model.react(conc, r);
+
+    std::string preamble = generateReactionPreamble(model, STENCIL_5_POINT);
+    std::ostringstream species;
+    species << "#define SPECIES " << Model::species << "\n";
+
+    int errors = 0;
+    if (preamble.find(species.str()) == std::string::npos) {
+        errors++;
+    }
+    for (int i = 0; i < 4; i++) {
+        std::ostringstream line;
+        line << "r[" << i << "] = ";
+        bool emitted = preamble.find(line.str()) != std::string::npos;
+        if (i < Model::species) {
+            line << terms[i] << ";";
+            if (!near(r[i], expected[i], 1e-6f) || std::string(Model::term(i)) != terms[i] ||
+                preamble.find(line.str()) == std::string::npos) {
+                errors++;
+            }
+        } else if (r[i] != 7.0f || emitted) {
+            errors++;
+        }
+    }
+    if (errors) {
+        std::cout << Model::name() << ": reaction terms do not match\n";
+    }
+    return errors;
+}
+
+static int testTermCounts()
+{
+    static const float decay[1] = { -0.25f };
+    static const char *const decayTerms[1] = { "-k * a" };
+    static const float cycle3[3] = { 0.75f, 0.125f, -2.9375f };
+    static const char *const cycle3Terms[3] = { "k * (c - a)", "k * (a - 2.0f * b)", "k * (b - 3.0f * c)" };
+    static const float cycle4[4] = { 1.75f, 0.125f, -2.9375f, -7.0f };
+    static const char *const cycle4Terms[4] = { "k * (d - a)", "k * (a - 2.0f * b)", "k * (b - 3.0f * c)",
+                                                "k * (c - 4.0f * d)" };
+
+    int errors = 0;
+    errors += testTerms(Decay1(), decay, decayTerms);
+    errors += testTerms(Cycle3(), cycle3, cycle3Terms);
+    errors += testTerms(Cycle4(), cycle4, cycle4Terms);
+    return errors;
+}
+
+template <class Model>
+static int testModel(const Model &model)
+{
+    int errors = 0;
+    errors += testUniform<STENCIL_5_POINT>(model);
+    errors += testUniform<STENCIL_ISOTROPIC>(model);
+    errors += testUniform<STENCIL_4TH_ORDER>(model);
+    errors += testStable<STENCIL_5_POINT>(model);
+    errors += testStable<STENCIL_ISOTROPIC>(model);
+    errors += testStable<STENCIL_4TH_ORDER>(model);
+    return errors;
+}
+
+int main()
+{
+    int errors = 0;
+
+    errors += testStencils();
+    errors += testModel(FitzHughNagumo());
+    errors += testModel(GrayScott());
+    errors += testModel(Brusselator());
+    errors += testModel(Schnakenberg());
+    errors += testTermCounts();
+    errors += testModel(Decay1());
+    errors += testModel(Cycle3());
+    errors += testModel(Cycle4());
+
+    std::cout << (errors ? "FAILED" : "passed") << "\n";
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
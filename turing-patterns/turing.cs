@@ -4,70 +4,56 @@ layout(local_size_x = 32, local_size_y = 32) in;
 layout(location = 0, binding = 0, rgba32f) uniform readonly  image2D oldConc;
 layout(location = 1, binding = 1, rgba32f) uniform writeonly image2D newConc;
 
-layout(location = 2) uniform float dx;
-layout(location = 3) uniform float dt;
-layout(location = 4) uniform float Da;
-layout(location = 5) uniform float Db;
-layout(location = 6) uniform float alpha;
-layout(location = 7) uniform float beta;
+// SPECIES, STENCIL, dx, dt, the diffusion coefficients D, the model parameters
+// and vec4 reaction(vec4 conc) are generated from reaction.h and inserted above.
 
-// 
-//       py0         y    
-//   px0 p11 px2     |  x - >  
-//       py2         V 
 //
+//               pyy0                   y
+//          p00  py0  p20               |  x - >
+//   pxx0   px0  p11  px2   pxx2        V
+//          p02  py2  p22
+//               pyy2
+//
+
+ivec2 imgSize;
+ivec2 p11Coords;
 
-float Ra (float a, float b)
+// neighbour at offset (ox, oy) from p11 with periodic edges
+vec4 at(int ox, int oy)
 {
-    return a - a*a*a - b + alpha;
+    return imageLoad(oldConc, (p11Coords + ivec2(ox, oy) + 2 * imgSize) % imgSize);
 }
 
-float Rb(float a, float b)
+vec4 laplacian(vec4 p11)
 {
-    return beta * (a - b);
+    vec4 near = at(-1, 0) + at(1, 0) + at(0, -1) + at(0, 1);
+#if STENCIL == STENCIL_ISOTROPIC
+    // 9-point isotropic: leading error term is rotationally symmetric
+    vec4 corners = at(-1, -1) + at(1, -1) + at(-1, 1) + at(1, 1);
+    return (4.0 * near + corners - 20.0 * p11) / (6.0 * dx * dx);
+#elif STENCIL == STENCIL_4TH_ORDER
+    // 4th-order accurate, reaches 2 cells along each axis
+    vec4 far = at(-2, 0) + at(2, 0) + at(0, -2) + at(0, 2);
+    return (16.0 * near - far - 60.0 * p11) / (12.0 * dx * dx);
+#else
+    return (near - 4.0 * p11) / (dx * dx);
+#endif
 }
 
 void main() {
-    ivec2 imgSize = imageSize(oldConc);
+    imgSize = imageSize(oldConc);
     // get index in global work group i.e x,y position
-    ivec2 py0Coords, py2Coords, px0Coords, px2Coords;
-    ivec2 p11Coords = ivec2(gl_GlobalInvocationID.xy);
-    
-    if (p11Coords.y > 0) {
-        py0Coords = p11Coords + ivec2( 0, -1);
-    } else {
-        py0Coords = ivec2(p11Coords.x, imgSize.y - 1);
-    }
-
-    if (p11Coords.y < imgSize.y - 1) {
-        py2Coords = p11Coords + ivec2( 0,  1);
-    } else {
-        py2Coords = ivec2(p11Coords.x, 0);
-    }
+    p11Coords = ivec2(gl_GlobalInvocationID.xy);
 
-    if (p11Coords.x > 0) {
-        px0Coords = p11Coords + ivec2(-1,  0);
-    } else {
-        px0Coords = ivec2(imgSize.x - 1, p11Coords.y);
+    // the dispatch is rounded up to whole work groups, skip cells outside the world
+    if (p11Coords.x >= imgSize.x || p11Coords.y >= imgSize.y) {
+        return;
     }
 
-    if (p11Coords.x < imgSize.x - 1) {
-        px2Coords = p11Coords + ivec2( 1,  0);
-    } else {
-        px2Coords = ivec2(0, p11Coords.y);
-    }
-
-
     vec4 p11 = imageLoad(oldConc, p11Coords).rgba;
-    vec4 py0 = imageLoad(oldConc, py0Coords).rgba;
-    vec4 py2 = imageLoad(oldConc, py2Coords).rgba;
-    vec4 px0 = imageLoad(oldConc, px0Coords).rgba;
-    vec4 px2 = imageLoad(oldConc, px2Coords).rgba;
-
-    vec4 L = (px2 + px0 + py2 + py0 - 4 * p11) / (dx * dx);
 
-    p11.x = p11.x + dt * ((Da * L.x) + Ra(p11.x, p11.y));
-    p11.y = p11.y + dt * ((Db * L.y) + Rb(p11.x, p11.y));
+    // diffusion and reaction are applied in the same pass
+    p11 = p11 + dt * (D * laplacian(p11) + reaction(p11));
 
     // output to a specific pixel in the image
     imageStore(newConc, p11Coords, p11);